@@ -0,0 +1,101 @@
+//! Performance regression coverage for the occara C++ layer. The numbers
+//! here are meant to run in CI so a slowdown after an OCCT bump shows up as
+//! a regression instead of a support ticket. Stage-level timings of the
+//! individual kernel operations are available through `occara::telemetry`.
+
+use criterion::{criterion_group, criterion_main, Criterion};
+use occara::geom::Point;
+use occara::shape::Shape;
+
+const WIDTH: f64 = 50.0;
+const HEIGHT: f64 = 70.0;
+const THICKNESS: f64 = 30.0;
+
+/// Full bottle evaluation versus an incremental rebuild after a single
+/// parameter change, which only re-evaluates the stages depending on it.
+fn make_bottle(c: &mut Criterion) {
+    let mut group = c.benchmark_group("make_bottle");
+    group.sample_size(10);
+    group.bench_function("full", |b| {
+        b.iter(|| occara::internal::make_bottle_cpp(WIDTH, HEIGHT, THICKNESS));
+    });
+    group.bench_function("incremental_width", |b| {
+        let mut pipeline = occara::internal::BottlePipeline::new();
+        pipeline.build(WIDTH, HEIGHT, THICKNESS);
+        let mut width = WIDTH;
+        b.iter(|| {
+            width = if (width - WIDTH).abs() < f64::EPSILON {
+                WIDTH + 1.0
+            } else {
+                WIDTH
+            };
+            pipeline.build(width, HEIGHT, THICKNESS)
+        });
+    });
+    group.finish();
+}
+
+/// One n-ary fuse over a row of overlapping spheres, at growing body
+/// counts.
+fn fuse_scaling(c: &mut Criterion) {
+    let mut group = c.benchmark_group("fuse_many");
+    group.sample_size(10);
+    for count in [2_usize, 4, 8] {
+        let spheres: Vec<Shape> = (0..count)
+            .map(|i| {
+                #[allow(clippy::cast_precision_loss)]
+                let center = Point::new(i as f64 * 5.0, 0.0, 0.0);
+                Shape::sphere(&center, 4.0)
+            })
+            .collect();
+        let refs: Vec<&Shape> = spheres.iter().collect();
+        group.bench_function(format!("{count}_bodies"), |b| {
+            b.iter(|| Shape::fuse_many(&refs));
+        });
+    }
+    group.finish();
+}
+
+/// Filleting a box with a growing subset of its twelve edges.
+fn fillet_scaling(c: &mut Criterion) {
+    let mut group = c.benchmark_group("fillet");
+    group.sample_size(10);
+    let cube = Shape::cuboid(&Point::new(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+    let edges = cube.edge_map();
+    for count in [4_u32, 8, 12] {
+        let indices: Vec<u32> = (0..count).collect();
+        group.bench_function(format!("{count}_edges"), |b| {
+            b.iter(|| {
+                let mut builder = cube.fillet();
+                builder.add_edges(0.5, &edges, &indices);
+                builder.build()
+            });
+        });
+    }
+    group.finish();
+}
+
+/// FFI crossing overhead: walking the edges of a compound one call at a
+/// time through the iterator versus building the indexed map in one call.
+fn iterator_overhead(c: &mut Criterion) {
+    let mut group = c.benchmark_group("iteration");
+    let cube = Shape::cuboid(&Point::new(0.0, 0.0, 0.0), 1.0, 1.0, 1.0);
+    let step = occara::geom::Transformation::translation(&occara::geom::Vector::new(2.0, 0.0, 0.0));
+    let compound = cube.pattern(&step, 50);
+    group.bench_function("edge_iterator", |b| {
+        b.iter(|| compound.edges().count());
+    });
+    group.bench_function("edge_map", |b| {
+        b.iter(|| compound.edge_map().len());
+    });
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    make_bottle,
+    fuse_scaling,
+    fillet_scaling,
+    iterator_overhead
+);
+criterion_main!(benches);
@@ -1,5 +1,74 @@
 use walkdir::WalkDir;
 
+/// Precompile `include/occara_pch.hpp` and inject it into every translation
+/// unit via `-include`. Opt-in through `OCCARA_PCH=1` since only gcc and
+/// clang understand the `.gch`/`.pch` sibling lookup; on any failure the
+/// build falls back to plain compilation with a warning.
+fn build_precompiled_header(
+    build: &mut cc::Build,
+    occt_include: &std::path::Path,
+) -> Result<(), String> {
+    let compiler = build.get_compiler();
+    if !compiler.is_like_gnu() && !compiler.is_like_clang() {
+        return Err("only gcc and clang are supported".to_string());
+    }
+    let out_dir = std::path::PathBuf::from(
+        std::env::var_os("OUT_DIR").ok_or_else(|| "OUT_DIR is not set".to_string())?,
+    );
+    // The compiled header must sit next to a copy of its source, and the
+    // -include below must name that copy by absolute path: resolved through
+    // the -I chain, the compiler would find the plain header in include/
+    // first and silently skip the precompiled one.
+    let header = out_dir.join("occara_pch.hpp");
+    std::fs::copy("include/occara_pch.hpp", &header)
+        .map_err(|e| format!("failed to copy occara_pch.hpp: {e}"))?;
+    let includes = [
+        "-Iinclude".to_string(),
+        format!("-I{}", occt_include.display()),
+    ];
+    // to_command() carries the same flag set (-std, -fPIC, opt level, ...)
+    // cc uses for the translation units; gcc rejects a precompiled header
+    // built with mismatched flags.
+    let status = compiler
+        .to_command()
+        .args(["-x", "c++-header"])
+        .args(&includes)
+        .arg(&header)
+        .arg("-o")
+        .arg(out_dir.join("occara_pch.hpp.gch"))
+        .status()
+        .map_err(|e| format!("failed to run {}: {e}", compiler.path().display()))?;
+    if !status.success() {
+        return Err(format!("precompilation exited with {status}"));
+    }
+    // Probe that the compiler actually loads the result instead of silently
+    // falling back to parsing the header.
+    let probe = out_dir.join("occara_pch_probe.cpp");
+    std::fs::write(&probe, "").map_err(|e| format!("failed to write probe: {e}"))?;
+    let status = compiler
+        .to_command()
+        .args(&includes)
+        .arg("-include")
+        .arg(&header)
+        .args(["-Winvalid-pch", "-Werror=invalid-pch", "-fsyntax-only"])
+        .arg(&probe)
+        .status()
+        .map_err(|e| format!("failed to run {}: {e}", compiler.path().display()))?;
+    if !status.success() {
+        return Err("compiler rejected the precompiled header".to_string());
+    }
+    let header = header
+        .to_str()
+        .ok_or_else(|| "OUT_DIR is not valid UTF-8".to_string())?;
+    build
+        .flag("-include")
+        .flag(header)
+        // Surface (instead of silently ignoring) a header/flag mismatch in
+        // the real translation units.
+        .flag("-Winvalid-pch");
+    Ok(())
+}
+
 fn main() -> miette::Result<()> {
     let build = opencascade_sys::OpenCascadeSource::new().build();
     // Find all cpp files in the cpp directory
@@ -51,8 +120,18 @@ fn main() -> miette::Result<()> {
     .extra_clang_args(&["-std=c++20"])
     .build()?;
 
+    // Set the flags consumed by get_compiler() before the PCH is built, so
+    // it is compiled exactly like the translation units it fronts.
+    autocxx_build.std("c++20");
+
+    println!("cargo:rerun-if-env-changed=OCCARA_PCH");
+    if std::env::var("OCCARA_PCH").as_deref() == Ok("1") {
+        if let Err(error) = build_precompiled_header(&mut autocxx_build, build.include_dir()) {
+            println!("cargo:warning=precompiled header disabled: {error}");
+        }
+    }
+
     autocxx_build
-        .std("c++20")
         .files(cpp_files)
         .compile("occara-autocxx-bridge");
     println!("cargo:rerun-if-changed=src/ffi.rs");
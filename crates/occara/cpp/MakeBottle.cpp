@@ -22,6 +22,7 @@
 // SOFTWARE
 
 #include "MakeBottle.hpp"
+#include "telemetry.hpp"
 
 #include <BRep_Tool.hxx>
 
@@ -77,29 +78,28 @@
 
 #include <TopTools_ListOfShape.hxx>
 
-occara::shape::Shape MakeBottle(const Standard_Real theWidth,
-                                const Standard_Real theHeight,
-                                const Standard_Real theThickness) {
-  // Profile : Define Support Points
+namespace {
+
+// Profile : support points, geometry, topology, mirrored and combined into
+// the full profile face of the bottle
+TopoDS_Shape MakeProfile(const Standard_Real theWidth,
+                         const Standard_Real theThickness) {
   gp_Pnt aPnt1(-theWidth / 2., 0, 0);
   gp_Pnt aPnt2(-theWidth / 2., -theThickness / 4., 0);
   gp_Pnt aPnt3(0, -theThickness / 2., 0);
   gp_Pnt aPnt4(theWidth / 2., -theThickness / 4., 0);
   gp_Pnt aPnt5(theWidth / 2., 0, 0);
 
-  // Profile : Define the Geometry
   Handle(Geom_TrimmedCurve) anArcOfCircle =
       GC_MakeArcOfCircle(aPnt2, aPnt3, aPnt4);
   Handle(Geom_TrimmedCurve) aSegment1 = GC_MakeSegment(aPnt1, aPnt2);
   Handle(Geom_TrimmedCurve) aSegment2 = GC_MakeSegment(aPnt4, aPnt5);
 
-  // Profile : Define the Topology
   TopoDS_Edge anEdge1 = BRepBuilderAPI_MakeEdge(aSegment1);
   TopoDS_Edge anEdge2 = BRepBuilderAPI_MakeEdge(anArcOfCircle);
   TopoDS_Edge anEdge3 = BRepBuilderAPI_MakeEdge(aSegment2);
   TopoDS_Wire aWire = BRepBuilderAPI_MakeWire(anEdge1, anEdge2, anEdge3);
 
-  // Complete Profile
   gp_Ax1 xAxis = gp::OX();
   gp_Trsf aTrsf;
 
@@ -113,14 +113,21 @@ occara::shape::Shape MakeBottle(const Standard_Real theWidth,
   mkWire.Add(aMirroredWire);
   TopoDS_Wire myWireProfile = mkWire.Wire();
 
-  // Body : Prism the Profile
-  TopoDS_Face myFaceProfile = BRepBuilderAPI_MakeFace(myWireProfile);
+  return BRepBuilderAPI_MakeFace(myWireProfile);
+}
+
+// Body : prism the profile face
+TopoDS_Shape MakeBody(const TopoDS_Shape &theProfile,
+                      const Standard_Real theHeight) {
   gp_Vec aPrismVec(0, 0, theHeight);
-  TopoDS_Shape myBody = BRepPrimAPI_MakePrism(myFaceProfile, aPrismVec);
+  return BRepPrimAPI_MakePrism(theProfile, aPrismVec);
+}
 
-  // Body : Apply Fillets
-  BRepFilletAPI_MakeFillet mkFillet(myBody);
-  TopExp_Explorer anEdgeExplorer(myBody, TopAbs_EDGE);
+// Body : apply fillets to every edge
+TopoDS_Shape MakeFilleted(const TopoDS_Shape &theBody,
+                          const Standard_Real theThickness) {
+  BRepFilletAPI_MakeFillet mkFillet(theBody);
+  TopExp_Explorer anEdgeExplorer(theBody, TopAbs_EDGE);
   while (anEdgeExplorer.More()) {
     TopoDS_Edge anEdge = TopoDS::Edge(anEdgeExplorer.Current());
     // Add edge to fillet algorithm
@@ -128,29 +135,39 @@ occara::shape::Shape MakeBottle(const Standard_Real theWidth,
     anEdgeExplorer.Next();
   }
 
-  myBody = mkFillet.Shape();
+  return mkFillet.Shape();
+}
 
-  // Body : Add the Neck
+gp_Ax2 NeckAxis(const Standard_Real theHeight) {
   gp_Pnt neckLocation(0, 0, theHeight);
   gp_Dir neckAxis = gp::DZ();
-  gp_Ax2 neckAx2(neckLocation, neckAxis);
+  return gp_Ax2(neckLocation, neckAxis);
+}
 
+// Body : the neck cylinder
+TopoDS_Shape MakeNeck(const Standard_Real theHeight,
+                      const Standard_Real theThickness) {
   Standard_Real myNeckRadius = theThickness / 4.;
   Standard_Real myNeckHeight = theHeight / 10.;
 
-  BRepPrimAPI_MakeCylinder MKCylinder(neckAx2, myNeckRadius, myNeckHeight);
-  TopoDS_Shape myNeck = MKCylinder.Shape();
+  BRepPrimAPI_MakeCylinder MKCylinder(NeckAxis(theHeight), myNeckRadius,
+                                      myNeckHeight);
+  return MKCylinder.Shape();
+}
 
-  myBody = BRepAlgoAPI_Fuse(myBody, myNeck);
+// Body : fuse body and neck, then hollow out through the top face of the neck
+TopoDS_Shape MakeShelled(const TopoDS_Shape &theFilleted,
+                         const TopoDS_Shape &theNeck,
+                         const Standard_Real theThickness) {
+  TopoDS_Shape myBody = BRepAlgoAPI_Fuse(theFilleted, theNeck);
 
-  // Body : Create a Hollowed Solid
   TopoDS_Face faceToRemove;
   Standard_Real zMax = -1;
 
   for (TopExp_Explorer aFaceExplorer(myBody, TopAbs_FACE); aFaceExplorer.More();
        aFaceExplorer.Next()) {
     TopoDS_Face aFace = TopoDS::Face(aFaceExplorer.Current());
-    // Check if <aFace> is the top face of the bottles neck
+    // Check if <aFace> is the top face of the bottles neck
     Handle(Geom_Surface) aSurface = BRep_Tool::Surface(aFace);
     if (aSurface->DynamicType() == STANDARD_TYPE(Geom_Plane)) {
       Handle(Geom_Plane) aPlane = Handle(Geom_Plane)::DownCast(aSurface);
@@ -168,14 +185,21 @@ occara::shape::Shape MakeBottle(const Standard_Real theWidth,
   BRepOffsetAPI_MakeThickSolid aSolidMaker;
   aSolidMaker.MakeThickSolidByJoin(myBody, facesToRemove, -theThickness / 50,
                                    1.e-3);
-  myBody = aSolidMaker.Shape();
-  // Threading : Create Surfaces
+  return aSolidMaker.Shape();
+}
+
+// Threading : surfaces, 2D curves, edges, wires and the lofted thread
+TopoDS_Shape MakeThreading(const Standard_Real theHeight,
+                           const Standard_Real theThickness) {
+  gp_Ax2 neckAx2 = NeckAxis(theHeight);
+  Standard_Real myNeckRadius = theThickness / 4.;
+  Standard_Real myNeckHeight = theHeight / 10.;
+
   Handle(Geom_CylindricalSurface) aCyl1 =
       new Geom_CylindricalSurface(neckAx2, myNeckRadius * 0.99);
   Handle(Geom_CylindricalSurface) aCyl2 =
       new Geom_CylindricalSurface(neckAx2, myNeckRadius * 1.05);
 
-  // Threading : Define 2D Curves
   gp_Pnt2d aPnt(2. * M_PI, myNeckHeight / 2.);
   gp_Dir2d aDir(2. * M_PI, myNeckHeight / 4.);
   gp_Ax2d anAx2d(aPnt, aDir);
@@ -196,7 +220,6 @@ occara::shape::Shape MakeBottle(const Standard_Real theWidth,
 
   Handle(Geom2d_TrimmedCurve) aSegment =
       GCE2d_MakeSegment(anEllipsePnt1, anEllipsePnt2);
-  // Threading : Build Edges and Wires
   TopoDS_Edge anEdge1OnSurf1 = BRepBuilderAPI_MakeEdge(anArc1, aCyl1);
   TopoDS_Edge anEdge2OnSurf1 = BRepBuilderAPI_MakeEdge(aSegment, aCyl1);
   TopoDS_Edge anEdge1OnSurf2 = BRepBuilderAPI_MakeEdge(anArc2, aCyl2);
@@ -208,20 +231,104 @@ occara::shape::Shape MakeBottle(const Standard_Real theWidth,
   BRepLib::BuildCurves3d(threadingWire1);
   BRepLib::BuildCurves3d(threadingWire2);
 
-  // Create Threading
   BRepOffsetAPI_ThruSections aTool(Standard_True);
   aTool.AddWire(threadingWire1);
   aTool.AddWire(threadingWire2);
   aTool.CheckCompatibility(Standard_False);
 
-  TopoDS_Shape myThreading = aTool.Shape();
+  return aTool.Shape();
+}
+
+} // namespace
+
+namespace occara::pipeline {
+
+// StageCache
+
+bool StageCache::up_to_date(Standard_Real first, Standard_Real second) const {
+  return valid && first_parameter == first && second_parameter == second;
+}
+
+void StageCache::store(const TopoDS_Shape &result, Standard_Real first,
+                       Standard_Real second) {
+  shape = result;
+  first_parameter = first;
+  second_parameter = second;
+  valid = true;
+}
+
+// BottlePipeline
 
-  // Building the Resulting Compound
+BottlePipeline BottlePipeline::create() { return BottlePipeline{}; }
+
+BottlePipeline BottlePipeline::clone() const { return *this; }
+
+occara::shape::Shape BottlePipeline::build(Standard_Real width,
+                                           Standard_Real height,
+                                           Standard_Real thickness) {
+  const telemetry::Stopwatch watch = telemetry::Stopwatch::start();
+  last_evaluated_stages = 0;
+
+  const bool profile_dirty = !profile.up_to_date(width, thickness);
+  if (profile_dirty) {
+    profile.store(MakeProfile(width, thickness), width, thickness);
+    ++last_evaluated_stages;
+  }
+
+  const bool body_dirty = profile_dirty || !body.up_to_date(height, 0.0);
+  if (body_dirty) {
+    body.store(MakeBody(profile.shape, height), height, 0.0);
+    ++last_evaluated_stages;
+  }
+
+  const bool filleted_dirty =
+      body_dirty || !filleted.up_to_date(thickness, 0.0);
+  if (filleted_dirty) {
+    filleted.store(MakeFilleted(body.shape, thickness), thickness, 0.0);
+    ++last_evaluated_stages;
+  }
+
+  const bool neck_dirty = !neck.up_to_date(height, thickness);
+  if (neck_dirty) {
+    neck.store(MakeNeck(height, thickness), height, thickness);
+    ++last_evaluated_stages;
+  }
+
+  const bool shelled_dirty =
+      filleted_dirty || neck_dirty || !shelled.up_to_date(thickness, 0.0);
+  if (shelled_dirty) {
+    shelled.store(MakeShelled(filleted.shape, neck.shape, thickness),
+                  thickness, 0.0);
+    ++last_evaluated_stages;
+  }
+
+  const bool threading_dirty = !threading.up_to_date(height, thickness);
+  if (threading_dirty) {
+    threading.store(MakeThreading(height, thickness), height, thickness);
+    ++last_evaluated_stages;
+  }
+
+  // Building the resulting compound is cheap, so it is not cached
   TopoDS_Compound aRes;
   BRep_Builder aBuilder;
   aBuilder.MakeCompound(aRes);
-  aBuilder.Add(aRes, myBody);
-  aBuilder.Add(aRes, myThreading);
+  aBuilder.Add(aRes, shelled.shape);
+  aBuilder.Add(aRes, threading.shape);
 
+  watch.finish("make_bottle", last_evaluated_stages);
   return occara::shape::Shape{TopoDS_Shape(aRes)};
 }
+
+size_t BottlePipeline::evaluated_stage_count() const {
+  return last_evaluated_stages;
+}
+
+} // namespace occara::pipeline
+
+occara::shape::Shape MakeBottle(const Standard_Real theWidth,
+                                const Standard_Real theHeight,
+                                const Standard_Real theThickness) {
+  occara::pipeline::BottlePipeline aPipeline =
+      occara::pipeline::BottlePipeline::create();
+  return aPipeline.build(theWidth, theHeight, theThickness);
+}
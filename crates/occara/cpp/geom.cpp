@@ -1,5 +1,41 @@
 #include "geom.hpp"
 #include "GCE2d_MakeSegment.hxx"
+#include "GC_MakeArcOfCircle.hxx"
+#include "GC_MakeSegment.hxx"
+
+namespace {
+
+// Shared inner loop of the batch sampling methods: evaluate count points
+// uniformly spaced in [u_start, u_end] into the caller-provided buffer.
+void sample_curve(const Handle(Geom_Curve) & curve, Standard_Real u_start,
+                  Standard_Real u_end, size_t count, Standard_Real *buffer) {
+  const Standard_Real step =
+      count > 1 ? (u_end - u_start) / static_cast<Standard_Real>(count - 1)
+                : 0.0;
+  for (size_t i = 0; i < count; ++i) {
+    const gp_Pnt point =
+        curve->Value(u_start + step * static_cast<Standard_Real>(i));
+    buffer[i * 3] = point.X();
+    buffer[i * 3 + 1] = point.Y();
+    buffer[i * 3 + 2] = point.Z();
+  }
+}
+
+void sample_curve_2d(const Handle(Geom2d_Curve) & curve, Standard_Real u_start,
+                     Standard_Real u_end, size_t count,
+                     Standard_Real *buffer) {
+  const Standard_Real step =
+      count > 1 ? (u_end - u_start) / static_cast<Standard_Real>(count - 1)
+                : 0.0;
+  for (size_t i = 0; i < count; ++i) {
+    const gp_Pnt2d point =
+        curve->Value(u_start + step * static_cast<Standard_Real>(i));
+    buffer[i * 2] = point.X();
+    buffer[i * 2 + 1] = point.Y();
+  }
+}
+
+} // namespace
 
 namespace occara::geom {
 
@@ -9,6 +45,16 @@ Point Point::create(Standard_Real x, Standard_Real y, Standard_Real z) {
   return Point{gp_Pnt(x, y, z)};
 }
 
+PointArray Point::create_many(const Standard_Real *coordinates, size_t count) {
+  PointArray array;
+  array.points.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    array.points.emplace_back(coordinates[i * 3], coordinates[i * 3 + 1],
+                              coordinates[i * 3 + 2]);
+  }
+  return array;
+}
+
 Point Point::clone() const { return *this; }
 
 void Point::get_coordinates(Standard_Real &x, Standard_Real &y,
@@ -22,6 +68,14 @@ double Point::x() const { return point.X(); }
 double Point::y() const { return point.Y(); }
 double Point::z() const { return point.Z(); }
 
+// PointArray
+
+PointArray PointArray::clone() const { return *this; }
+
+size_t PointArray::size() const { return points.size(); }
+
+Point PointArray::at(size_t index) const { return Point{points[index]}; }
+
 // Point2D
 
 Point2D Point2D::create(Standard_Real x, Standard_Real y) {
@@ -107,6 +161,11 @@ TrimmedCurve TrimmedCurve::line(const Point &p1, const Point &p2) {
 
 TrimmedCurve TrimmedCurve::clone() const { return *this; }
 
+void TrimmedCurve::sample(Standard_Real u_start, Standard_Real u_end,
+                          size_t count, Standard_Real *buffer) const {
+  sample_curve(curve, u_start, u_end, count, buffer);
+}
+
 // TrimmedCurve2D
 
 TrimmedCurve2D TrimmedCurve2D::line(const Point2D &p1, const Point2D &p2) {
@@ -115,6 +174,11 @@ TrimmedCurve2D TrimmedCurve2D::line(const Point2D &p1, const Point2D &p2) {
 
 TrimmedCurve2D TrimmedCurve2D::clone() const { return *this; }
 
+void TrimmedCurve2D::sample(Standard_Real u_start, Standard_Real u_end,
+                            size_t count, Standard_Real *buffer) const {
+  sample_curve_2d(curve, u_start, u_end, count, buffer);
+}
+
 // Curve2D
 Curve2D Curve2D::from_trimmed_curve2d(const TrimmedCurve2D &curve) {
   return Curve2D{const_cast<TrimmedCurve2D &>(curve).curve};
@@ -126,6 +190,11 @@ TrimmedCurve2D Curve2D::trim(Standard_Real u1, Standard_Real u2) const {
   return TrimmedCurve2D{new Geom2d_TrimmedCurve(curve, u1, u2)};
 }
 
+void Curve2D::sample(Standard_Real u_start, Standard_Real u_end, size_t count,
+                     Standard_Real *buffer) const {
+  sample_curve_2d(curve, u_start, u_end, count, buffer);
+}
+
 // Ellipse2D
 
 Ellipse2D Ellipse2D::create(const Axis2D &axis, Standard_Real major_radius,
@@ -143,6 +212,11 @@ Curve2D Ellipse2D::curve() const {
   return Curve2D{const_cast<Ellipse2D &>(*this).ellipse};
 }
 
+void Ellipse2D::sample(Standard_Real u_start, Standard_Real u_end,
+                       size_t count, Standard_Real *buffer) const {
+  sample_curve_2d(ellipse, u_start, u_end, count, buffer);
+}
+
 // Plane
 
 Plane Plane::clone() const { return *this; }
@@ -173,6 +247,14 @@ void Transformation::mirror(const Axis &axis) {
   transformation.SetMirror(axis.axis);
 }
 
+void Transformation::translate(const Vector &vector) {
+  transformation.SetTranslation(vector.vector);
+}
+
+void Transformation::rotate(const Axis &axis, Standard_Real angle) {
+  transformation.SetRotation(axis.axis, angle);
+}
+
 // CylindricalSurface
 
 CylindricalSurface CylindricalSurface::create(const PlaneAxis &axis,
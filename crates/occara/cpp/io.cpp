@@ -0,0 +1,223 @@
+#include "io.hpp"
+#include "BinTools.hxx"
+#include "STEPControl_Reader.hxx"
+#include "STEPControl_Writer.hxx"
+#include "Standard_Failure.hxx"
+#include "TopoDS_Iterator.hxx"
+#include "shape.hpp"
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+namespace {
+
+// Archive layout: magic, record count, offset/size table, then the records.
+constexpr uint64_t kArchiveMagic = 0x3152414143434FULL; // "OCAAR1\0\0"
+
+void write_u64(std::ostream &stream, uint64_t value) {
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+uint64_t read_u64(std::istream &stream) {
+  uint64_t value = 0;
+  stream.read(reinterpret_cast<char *>(&value), sizeof(value));
+  return value;
+}
+
+// The STEPControl translators keep global state (the XSTEP work session),
+// so all STEP jobs are serialized behind this mutex; read_async in
+// particular may dispatch several overlapping jobs onto the worker pool.
+std::mutex &step_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+} // namespace
+
+namespace occara::io {
+
+// ShapeData
+
+ShapeData ShapeData::serialize(const occara::shape::Shape &shape) {
+  std::ostringstream stream(std::ios::binary);
+  BinTools::Write(shape.shape, stream);
+  const std::string buffer = stream.str();
+  return ShapeData{std::vector<char>(buffer.begin(), buffer.end())};
+}
+
+occara::shape::Shape
+ShapeData::deserialize(const uint8_t *data, size_t size,
+                       occara::shape::OperationStatus &status) {
+  std::istringstream stream(
+      std::string(reinterpret_cast<const char *>(data), size),
+      std::ios::binary);
+  TopoDS_Shape shape;
+  try {
+    BinTools::Read(shape, stream);
+  } catch (const Standard_Failure &failure) {
+    status.failed = true;
+    status.message = failure.GetMessageString() != nullptr
+                         ? failure.GetMessageString()
+                         : failure.DynamicType()->Name();
+    return occara::shape::Shape{};
+  } catch (const std::exception &error) {
+    status.failed = true;
+    status.message = error.what();
+    return occara::shape::Shape{};
+  }
+  if (!stream || shape.IsNull()) {
+    status.failed = true;
+    status.message = "binary BRep data is corrupted or truncated";
+    return occara::shape::Shape{};
+  }
+  return occara::shape::Shape{shape};
+}
+
+ShapeData ShapeData::clone() const { return *this; }
+
+const uint8_t *ShapeData::data() const {
+  return reinterpret_cast<const uint8_t *>(bytes.data());
+}
+
+size_t ShapeData::size() const { return bytes.size(); }
+
+// ShapeArchive
+
+void ShapeArchive::save(const occara::shape::Shape &shape, std::string path) {
+  // One record per direct sub-shape; a non-compound shape becomes one record.
+  std::vector<std::string> records;
+  TopoDS_Iterator iterator(shape.shape);
+  if (iterator.More()) {
+    for (; iterator.More(); iterator.Next()) {
+      std::ostringstream record(std::ios::binary);
+      BinTools::Write(iterator.Value(), record);
+      records.push_back(record.str());
+    }
+  } else {
+    std::ostringstream record(std::ios::binary);
+    BinTools::Write(shape.shape, record);
+    records.push_back(record.str());
+  }
+
+  std::ofstream stream(path, std::ios::binary);
+  write_u64(stream, kArchiveMagic);
+  write_u64(stream, records.size());
+  uint64_t offset =
+      sizeof(uint64_t) * (2 + 2 * records.size()); // header plus index table
+  for (const std::string &record : records) {
+    write_u64(stream, offset);
+    write_u64(stream, record.size());
+    offset += record.size();
+  }
+  for (const std::string &record : records) {
+    stream.write(record.data(),
+                 static_cast<std::streamsize>(record.size()));
+  }
+}
+
+ShapeArchive ShapeArchive::open(std::string path) {
+  ShapeArchive archive;
+  archive.path = path;
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream || read_u64(stream) != kArchiveMagic) {
+    return archive;
+  }
+  const uint64_t count = read_u64(stream);
+  archive.offsets.reserve(count);
+  archive.sizes.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    archive.offsets.push_back(read_u64(stream));
+    archive.sizes.push_back(read_u64(stream));
+  }
+  archive.shapes.resize(count);
+  archive.loaded.resize(count, false);
+  return archive;
+}
+
+ShapeArchive ShapeArchive::clone() const { return *this; }
+
+size_t ShapeArchive::size() const { return offsets.size(); }
+
+bool ShapeArchive::is_loaded(size_t index) const {
+  return index < loaded.size() && loaded[index];
+}
+
+occara::shape::Shape ShapeArchive::load(size_t index) {
+  if (loaded[index]) {
+    return occara::shape::Shape{shapes[index]};
+  }
+  // The file may have been truncated or rewritten since open() read the
+  // index; a record that cannot be read back yields a null shape (and is
+  // not cached, so a repaired file can be retried).
+  std::ifstream stream(path, std::ios::binary);
+  stream.seekg(static_cast<std::streamoff>(offsets[index]));
+  std::string record(sizes[index], '\0');
+  stream.read(record.data(), static_cast<std::streamsize>(record.size()));
+  if (!stream) {
+    return occara::shape::Shape{};
+  }
+  std::istringstream record_stream(record, std::ios::binary);
+  TopoDS_Shape shape;
+  try {
+    BinTools::Read(shape, record_stream);
+  } catch (const Standard_Failure &) {
+    return occara::shape::Shape{};
+  } catch (const std::exception &) {
+    return occara::shape::Shape{};
+  }
+  if (!record_stream || shape.IsNull()) {
+    return occara::shape::Shape{};
+  }
+  shapes[index] = shape;
+  loaded[index] = true;
+  return occara::shape::Shape{shape};
+}
+
+// StepFile
+
+occara::shape::Shape StepFile::read(std::string path,
+                                    occara::shape::OperationStatus &status) {
+  const std::lock_guard<std::mutex> lock(step_mutex());
+  STEPControl_Reader reader;
+  if (reader.ReadFile(path.c_str()) != IFSelect_RetDone) {
+    status.failed = true;
+    status.message = "could not read STEP file: " + path;
+    return occara::shape::Shape{};
+  }
+  reader.TransferRoots();
+  occara::shape::Shape result{reader.OneShape()};
+  if (result.shape.IsNull()) {
+    status.failed = true;
+    status.message = "STEP file holds no translatable roots: " + path;
+  }
+  return result;
+}
+
+task::PendingShape StepFile::read_async(std::string path) {
+  return task::run_async([path = std::move(path)]() {
+    occara::shape::OperationStatus status;
+    return read(path, status).shape;
+  });
+}
+
+bool StepFile::write(const occara::shape::Shape &shape, std::string path) {
+  const std::lock_guard<std::mutex> lock(step_mutex());
+  STEPControl_Writer writer;
+  if (writer.Transfer(shape.shape, STEPControl_AsIs) != IFSelect_RetDone) {
+    return false;
+  }
+  return writer.Write(path.c_str()) == IFSelect_RetDone;
+}
+
+} // namespace occara::io
+
+namespace occara::shape {
+
+io::ShapeData Shape::serialize() const { return io::ShapeData::serialize(*this); }
+
+Shape Shape::deserialize(const uint8_t *data, size_t size,
+                         OperationStatus &status) {
+  return io::ShapeData::deserialize(data, size, status);
+}
+
+} // namespace occara::shape
@@ -0,0 +1,126 @@
+#include "mesh.hpp"
+#include "BRepLib_ToolTriangulatedShape.hxx"
+#include "BRepMesh_IncrementalMesh.hxx"
+#include "BRep_Tool.hxx"
+#include "Poly_Triangulation.hxx"
+#include "TopLoc_Location.hxx"
+#include "TopoDS.hxx"
+#include "shape.hpp"
+
+namespace occara::mesh {
+
+// Mesh
+
+Mesh Mesh::triangulate(const occara::shape::Shape &shape,
+                       Standard_Real deflection) {
+  BRepMesh_IncrementalMesh mesher(shape.shape, deflection);
+  Mesh mesh;
+  MeshData &data = *mesh.data;
+  data.face_offsets.push_back(0);
+  for (TopExp_Explorer explorer(shape.shape, TopAbs_FACE); explorer.More();
+       explorer.Next()) {
+    const TopoDS_Face face = TopoDS::Face(explorer.Current());
+    TopLoc_Location location;
+    Handle(Poly_Triangulation) triangulation =
+        BRep_Tool::Triangulation(face, location);
+    if (triangulation.IsNull()) {
+      data.face_offsets.push_back(
+          static_cast<uint32_t>(data.indices.size() / 3));
+      continue;
+    }
+    BRepLib_ToolTriangulatedShape::ComputeNormals(face, triangulation);
+    const gp_Trsf transformation = location.Transformation();
+    const bool reversed = face.Orientation() == TopAbs_REVERSED;
+    const auto base = static_cast<uint32_t>(data.vertices.size() / 3);
+    for (Standard_Integer i = 1; i <= triangulation->NbNodes(); ++i) {
+      const gp_Pnt node = triangulation->Node(i).Transformed(transformation);
+      data.vertices.push_back(node.X());
+      data.vertices.push_back(node.Y());
+      data.vertices.push_back(node.Z());
+      gp_Dir normal = triangulation->Normal(i).Transformed(transformation);
+      if (reversed) {
+        normal.Reverse();
+      }
+      data.normals.push_back(normal.X());
+      data.normals.push_back(normal.Y());
+      data.normals.push_back(normal.Z());
+    }
+    for (Standard_Integer i = 1; i <= triangulation->NbTriangles(); ++i) {
+      Standard_Integer n1 = 0, n2 = 0, n3 = 0;
+      triangulation->Triangle(i).Get(n1, n2, n3);
+      if (reversed) {
+        std::swap(n2, n3);
+      }
+      data.indices.push_back(base + static_cast<uint32_t>(n1 - 1));
+      data.indices.push_back(base + static_cast<uint32_t>(n2 - 1));
+      data.indices.push_back(base + static_cast<uint32_t>(n3 - 1));
+    }
+    data.face_offsets.push_back(static_cast<uint32_t>(data.indices.size() / 3));
+  }
+  return mesh;
+}
+
+Mesh Mesh::clone() const { return *this; }
+
+size_t Mesh::vertex_count() const { return data->vertices.size() / 3; }
+
+size_t Mesh::triangle_count() const { return data->indices.size() / 3; }
+
+size_t Mesh::face_count() const {
+  return data->face_offsets.empty() ? 0 : data->face_offsets.size() - 1;
+}
+
+const Standard_Real *Mesh::vertex_data() const {
+  return data->vertices.data();
+}
+
+const Standard_Real *Mesh::normal_data() const { return data->normals.data(); }
+
+const uint32_t *Mesh::index_data() const { return data->indices.data(); }
+
+const uint32_t *Mesh::face_offset_data() const {
+  return data->face_offsets.data();
+}
+
+size_t Mesh::face_offset_count() const { return data->face_offsets.size(); }
+
+// MeshCache
+
+MeshCache MeshCache::create(const occara::shape::Shape &shape) {
+  return MeshCache{shape.shape, {}};
+}
+
+MeshCache MeshCache::clone() const { return *this; }
+
+Mesh MeshCache::level(Standard_Real deflection) {
+  const auto entry = levels.find(deflection);
+  if (entry != levels.end()) {
+    return entry->second;
+  }
+  Mesh mesh = Mesh::triangulate(occara::shape::Shape{shape}, deflection);
+  levels.emplace(deflection, mesh);
+  return mesh;
+}
+
+bool MeshCache::has_level(Standard_Real deflection) const {
+  return levels.find(deflection) != levels.end();
+}
+
+size_t MeshCache::level_count() const { return levels.size(); }
+
+void MeshCache::reset(const occara::shape::Shape &shape) {
+  this->shape = shape.shape;
+  levels.clear();
+}
+
+void MeshCache::clear() { levels.clear(); }
+
+} // namespace occara::mesh
+
+namespace occara::shape {
+
+mesh::Mesh Shape::triangulate(Standard_Real deflection) const {
+  return mesh::Mesh::triangulate(*this, deflection);
+}
+
+} // namespace occara::shape
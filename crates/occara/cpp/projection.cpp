@@ -0,0 +1,110 @@
+#include "projection.hpp"
+#include "telemetry.hpp"
+#include "BRepLib.hxx"
+#include "HLRAlgo_Projector.hxx"
+#include "HLRBRep_Algo.hxx"
+#include "HLRBRep_HLRToShape.hxx"
+#include "Standard_Failure.hxx"
+#include <chrono>
+#include <memory>
+
+namespace occara::projection {
+
+namespace {
+
+// The extractor hands out edges carrying only 2D curves in the projection
+// plane; build their 3D curves so the result can be sampled and exported
+// like any other shape. A compound the projection did not produce is null.
+TopoDS_Shape finish_compound(TopoDS_Shape edges) {
+  if (!edges.IsNull()) {
+    BRepLib::BuildCurves3d(edges);
+  }
+  return edges;
+}
+
+} // namespace
+
+// ProjectedEdges
+
+ProjectedEdges ProjectedEdges::clone() const { return *this; }
+
+occara::shape::Shape ProjectedEdges::visible_edges() const {
+  return occara::shape::Shape{visible};
+}
+
+occara::shape::Shape ProjectedEdges::visible_outline_edges() const {
+  return occara::shape::Shape{visible_outlines};
+}
+
+occara::shape::Shape ProjectedEdges::hidden_edges() const {
+  return occara::shape::Shape{hidden};
+}
+
+occara::shape::Shape ProjectedEdges::hidden_outline_edges() const {
+  return occara::shape::Shape{hidden_outlines};
+}
+
+// PendingProjection
+
+PendingProjection PendingProjection::clone() const { return *this; }
+
+bool PendingProjection::is_ready() const {
+  return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+ProjectedEdges PendingProjection::wait() const {
+  // See PendingShape::wait: a projection that failed with a kernel
+  // exception yields null edge compounds instead of rethrowing.
+  try {
+    return future.get();
+  } catch (const Standard_Failure &) {
+    return ProjectedEdges{};
+  } catch (const std::exception &) {
+    return ProjectedEdges{};
+  }
+}
+
+// HiddenLineProjector
+
+HiddenLineProjector
+HiddenLineProjector::create(const occara::shape::Shape &shape) {
+  return HiddenLineProjector{shape};
+}
+
+HiddenLineProjector HiddenLineProjector::clone() const { return *this; }
+
+ProjectedEdges
+HiddenLineProjector::project(const occara::geom::PlaneAxis &view) const {
+  return project_view(view.axis);
+}
+
+PendingProjection
+HiddenLineProjector::project_async(const occara::geom::PlaneAxis &view) const {
+  auto packaged = std::make_shared<std::packaged_task<ProjectedEdges()>>(
+      [projector = *this, axis = view.axis] {
+        return projector.project_view(axis);
+      });
+  std::shared_future<ProjectedEdges> future = packaged->get_future().share();
+  occara::task::enqueue([packaged] { (*packaged)(); });
+  return PendingProjection{std::move(future)};
+}
+
+ProjectedEdges HiddenLineProjector::project_view(const gp_Ax2 &view) const {
+  const telemetry::Stopwatch watch = telemetry::Stopwatch::start();
+  // A fresh algorithm per view keeps concurrent projections of the same
+  // projector independent; loading the shape is cheap next to Update().
+  Handle(HLRBRep_Algo) algo = new HLRBRep_Algo();
+  algo->Add(shape.shape);
+  algo->Projector(HLRAlgo_Projector(view));
+  algo->Update();
+  algo->Hide();
+  HLRBRep_HLRToShape extractor(algo);
+  ProjectedEdges result{finish_compound(extractor.VCompound()),
+                        finish_compound(extractor.OutLineVCompound()),
+                        finish_compound(extractor.HCompound()),
+                        finish_compound(extractor.OutLineHCompound())};
+  watch.finish("hidden_line_projection", 1);
+  return result;
+}
+
+} // namespace occara::projection
@@ -1,22 +1,125 @@
 #include "shape.hpp"
+#include "telemetry.hpp"
+#include "BRepAlgoAPI_Common.hxx"
+#include "BRepAlgoAPI_Cut.hxx"
 #include "BRepAlgoAPI_Fuse.hxx"
+#include "BRepBndLib.hxx"
+#include "BRepBuilderAPI_MakeEdge.hxx"
+#include "BRepBuilderAPI_MakeFace.hxx"
+#include "BRepBuilderAPI_MakeVertex.hxx"
+#include "BRepBuilderAPI_Transform.hxx"
+#include "BRepCheck_Analyzer.hxx"
+#include "BRepExtrema_DistShapeShape.hxx"
+#include "BRepOffsetAPI_MakePipe.hxx"
+#include "BRepOffsetAPI_MakeThickSolid.hxx"
+#include "BRepPrimAPI_MakeBox.hxx"
+#include "BRepPrimAPI_MakeCone.hxx"
 #include "BRepPrimAPI_MakeCylinder.hxx"
+#include "BRepPrimAPI_MakePrism.hxx"
+#include "BRepPrimAPI_MakeRevol.hxx"
+#include "BRepPrimAPI_MakeSphere.hxx"
+#include "BRepPrimAPI_MakeTorus.hxx"
+#include "BRep_Tool.hxx"
+#include "BinTools.hxx"
+#include "Geom_BSplineCurve.hxx"
+#include "Geom_BSplineSurface.hxx"
+#include "Geom_ConicalSurface.hxx"
+#include "Geom_SphericalSurface.hxx"
+#include "Geom_ToroidalSurface.hxx"
+#include "Poly_Triangulation.hxx"
+#include "Precision.hxx"
+#include "ShapeFix_Shape.hxx"
+#include "Standard_Failure.hxx"
+#include "TopExp.hxx"
+#include "TopLoc_Location.hxx"
+#include "TopoDS.hxx"
+#include "TopoDS_Iterator.hxx"
+#include "gp_Lin.hxx"
 #include <BRepLib.hxx>
+#include <set>
+#include <sstream>
+
+namespace {
+
+occara::shape::Shape
+run_boolean(BRepAlgoAPI_BooleanOperation &operation, const char *name,
+            const TopTools_ListOfShape &arguments,
+            const TopTools_ListOfShape &tools) {
+  const occara::telemetry::Stopwatch watch =
+      occara::telemetry::Stopwatch::start();
+  operation.SetArguments(arguments);
+  operation.SetTools(tools);
+  operation.SetRunParallel(Standard_True);
+  operation.Build();
+  watch.finish(name, static_cast<uint64_t>(tools.Size()));
+  return occara::shape::Shape{operation.Shape()};
+}
+
+// Runs an operation that may throw inside the kernel and converts any
+// exception into a failure status, so nothing unwinds across the FFI
+// boundary.
+template <typename Operation>
+occara::shape::Shape guarded(occara::shape::OperationStatus &status,
+                             Operation &&operation) {
+  status = occara::shape::OperationStatus{};
+  try {
+    return operation();
+  } catch (const Standard_Failure &failure) {
+    status.failed = true;
+    status.message = failure.GetMessageString() != nullptr
+                         ? failure.GetMessageString()
+                         : failure.DynamicType()->Name();
+  } catch (const std::exception &error) {
+    status.failed = true;
+    status.message = error.what();
+  }
+  return occara::shape::Shape{};
+}
+
+} // namespace
 
 namespace occara::shape {
 
+// OperationStatus
+
+OperationStatus OperationStatus::clone() const { return *this; }
+
+bool OperationStatus::is_failure() const { return failed; }
+
+std::string OperationStatus::error_message() const { return message; }
+
 // Vertex
 
 Vertex Vertex::create(const geom::Point &point) {
   return Vertex{BRepBuilderAPI_MakeVertex(point.point)};
 }
 
+VertexArray Vertex::create_many(const Standard_Real *coordinates,
+                                size_t count) {
+  VertexArray array;
+  array.vertices.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    array.vertices.emplace_back(BRepBuilderAPI_MakeVertex(
+        gp_Pnt(coordinates[i * 3], coordinates[i * 3 + 1],
+               coordinates[i * 3 + 2])));
+  }
+  return array;
+}
+
 Vertex Vertex::clone() const { return *this; }
 
 geom::Point Vertex::point() const {
   return geom::Point{BRep_Tool::Pnt(vertex)};
 }
 
+// VertexArray
+
+VertexArray VertexArray::clone() const { return *this; }
+
+size_t VertexArray::size() const { return vertices.size(); }
+
+Vertex VertexArray::at(size_t index) const { return Vertex{vertices[index]}; }
+
 // FilletBuilder
 
 FilletBuilder FilletBuilder::clone() const { return *this; }
@@ -25,7 +128,57 @@ void FilletBuilder::add_edge(Standard_Real radius, const Edge &edge) {
   make_fillet.Add(radius, edge.edge);
 }
 
-Shape FilletBuilder::build() { return Shape{make_fillet.Shape()}; }
+void FilletBuilder::add_all_edges(Standard_Real radius, const Shape &shape) {
+  for (TopExp_Explorer explorer(shape.shape, TopAbs_EDGE); explorer.More();
+       explorer.Next()) {
+    make_fillet.Add(radius, TopoDS::Edge(explorer.Current()));
+  }
+}
+
+void FilletBuilder::add_edge_indices(Standard_Real radius,
+                                     const EdgeMap &edges,
+                                     const uint32_t *indices, size_t count) {
+  const size_t extent = static_cast<size_t>(edges.map.Extent());
+  for (size_t i = 0; i < count; ++i) {
+    if (indices[i] >= extent) {
+      continue;
+    }
+    make_fillet.Add(
+        radius,
+        TopoDS::Edge(edges.map(static_cast<Standard_Integer>(indices[i]) + 1)));
+  }
+}
+
+void FilletBuilder::track_progress(const task::ProgressTracker &tracker) {
+  progress = tracker;
+}
+
+Shape FilletBuilder::build() {
+  const telemetry::Stopwatch watch = telemetry::Stopwatch::start();
+  Handle(Message_ProgressIndicator) indicator =
+      task::make_progress_indicator(progress);
+  make_fillet.Build(indicator->Start());
+  watch.finish("fillet",
+               static_cast<uint64_t>(make_fillet.NbContours()));
+  if (!make_fillet.IsDone()) {
+    return Shape{};
+  }
+  return Shape{make_fillet.Shape()};
+}
+
+Shape FilletBuilder::try_build(OperationStatus &status) {
+  Shape result = guarded(status, [this]() { return build(); });
+  if (!status.failed && result.shape.IsNull()) {
+    status.failed = true;
+    status.message = "fillet construction did not complete";
+  }
+  return result;
+}
+
+task::PendingShape FilletBuilder::build_async() const {
+  return task::run_async(
+      [builder = *this]() mutable { return builder.build().shape; });
+}
 
 // ShellBuilder
 
@@ -45,23 +198,145 @@ void ShellBuilder::set_tolerance(Standard_Real tolerance) {
   this->tolerance = tolerance;
 }
 
+void ShellBuilder::track_progress(const task::ProgressTracker &tracker) {
+  progress = tracker;
+}
+
 Shape ShellBuilder::build() {
+  const telemetry::Stopwatch watch = telemetry::Stopwatch::start();
+  Handle(Message_ProgressIndicator) indicator =
+      task::make_progress_indicator(progress);
   BRepOffsetAPI_MakeThickSolid make_thick_solid;
   make_thick_solid.MakeThickSolidByJoin(shape, faces_to_remove, offset,
-                                        tolerance);
+                                        tolerance, BRepOffset_Skin,
+                                        Standard_False, Standard_False,
+                                        GeomAbs_Arc, Standard_False,
+                                        indicator->Start());
+  watch.finish("shell", static_cast<uint64_t>(faces_to_remove.Size()));
+  if (!make_thick_solid.IsDone()) {
+    return Shape{};
+  }
   return Shape{make_thick_solid.Shape()};
 }
 
+Shape ShellBuilder::try_build(OperationStatus &status) {
+  Shape result = guarded(status, [this]() { return build(); });
+  if (!status.failed && result.shape.IsNull()) {
+    status.failed = true;
+    status.message = "thick solid construction did not complete";
+  }
+  return result;
+}
+
+task::PendingShape ShellBuilder::build_async() const {
+  return task::run_async(
+      [builder = *this]() mutable { return builder.build().shape; });
+}
+
 // Shape
 
 Shape Shape::clone() const { return *this; }
 
+bool Shape::is_null() const { return shape.IsNull(); }
+
 FilletBuilder Shape::fillet() const {
   return FilletBuilder{BRepFilletAPI_MakeFillet(shape)};
 }
 
 Shape Shape::fuse(const Shape &other) const {
-  return Shape{BRepAlgoAPI_Fuse(shape, other.shape).Shape()};
+  const telemetry::Stopwatch watch = telemetry::Stopwatch::start();
+  Shape result{BRepAlgoAPI_Fuse(shape, other.shape).Shape()};
+  watch.finish("fuse", 1);
+  return result;
+}
+
+Shape Shape::try_fuse(const Shape &other, OperationStatus &status) const {
+  return guarded(status, [&]() { return fuse(other); });
+}
+
+Shape Shape::fuse_many(const ShapeList &shapes) {
+  if (shapes.shapes.IsEmpty()) {
+    return Shape{};
+  }
+  TopTools_ListOfShape arguments, tools;
+  for (const TopoDS_Shape &shape : shapes.shapes) {
+    (arguments.IsEmpty() ? arguments : tools).Append(shape);
+  }
+  if (tools.IsEmpty()) {
+    return Shape{arguments.First()};
+  }
+  BRepAlgoAPI_Fuse operation;
+  return run_boolean(operation, "fuse_many", arguments, tools);
+}
+
+Shape Shape::cut_many(const ShapeList &tools) const {
+  if (tools.shapes.IsEmpty()) {
+    return clone();
+  }
+  TopTools_ListOfShape arguments;
+  arguments.Append(shape);
+  BRepAlgoAPI_Cut operation;
+  return run_boolean(operation, "cut_many", arguments, tools.shapes);
+}
+
+Shape Shape::common_many(const ShapeList &tools) const {
+  if (tools.shapes.IsEmpty()) {
+    return clone();
+  }
+  TopTools_ListOfShape arguments;
+  arguments.Append(shape);
+  BRepAlgoAPI_Common operation;
+  return run_boolean(operation, "common_many", arguments, tools.shapes);
+}
+
+EdgeMap Shape::edge_map() const { return EdgeMap::create(*this); }
+
+FaceMap Shape::face_map() const { return FaceMap::create(*this); }
+
+FaceClassification Shape::classify_faces() const {
+  return FaceClassification::create(*this);
+}
+
+SpatialIndex Shape::build_bvh() const { return SpatialIndex(*this); }
+
+MemoryStats Shape::memory_stats() const { return MemoryStats::create(*this); }
+
+bool Shape::check() const {
+  const BRepCheck_Analyzer analyzer(shape, Standard_True, Standard_True);
+  return analyzer.IsValid() == Standard_True;
+}
+
+Shape Shape::heal() const {
+  const telemetry::Stopwatch watch = telemetry::Stopwatch::start();
+  Handle(ShapeFix_Shape) fix = new ShapeFix_Shape(shape);
+  fix->Perform();
+  watch.finish("heal", 1);
+  return Shape{fix->Shape()};
+}
+
+BoundingBox Shape::aabb() const {
+  if (aabb_cached == Standard_False) {
+    cached_aabb = Bnd_Box();
+    BRepBndLib::Add(shape, cached_aabb);
+    aabb_cached = Standard_True;
+  }
+  return BoundingBox{cached_aabb};
+}
+
+Shape Shape::moved(const geom::Transformation &transformation) const {
+  return Shape{shape.Moved(TopLoc_Location(transformation.transformation))};
+}
+
+Shape Shape::pattern(const geom::Transformation &step, size_t count) const {
+  TopoDS_Compound compound;
+  BRep_Builder builder;
+  builder.MakeCompound(compound);
+  gp_Trsf accumulated;
+  for (size_t i = 0; i < count; ++i) {
+    builder.Add(compound, shape.Moved(TopLoc_Location(accumulated)));
+    accumulated = step.transformation * accumulated;
+  }
+  return Shape{compound};
 }
 
 Shape Shape::cylinder(const occara::geom::PlaneAxis &axis, Standard_Real radius,
@@ -70,6 +345,29 @@ Shape Shape::cylinder(const occara::geom::PlaneAxis &axis, Standard_Real radius,
   return Shape{cylinder.Shape()};
 }
 
+Shape Shape::cuboid(const occara::geom::Point &corner, Standard_Real dx,
+                    Standard_Real dy, Standard_Real dz) {
+  BRepPrimAPI_MakeBox box(corner.point, dx, dy, dz);
+  return Shape{box.Shape()};
+}
+
+Shape Shape::sphere(const occara::geom::Point &center, Standard_Real radius) {
+  BRepPrimAPI_MakeSphere sphere(center.point, radius);
+  return Shape{sphere.Shape()};
+}
+
+Shape Shape::cone(const occara::geom::PlaneAxis &axis, Standard_Real radius1,
+                  Standard_Real radius2, Standard_Real height) {
+  BRepPrimAPI_MakeCone cone(axis.axis, radius1, radius2, height);
+  return Shape{cone.Shape()};
+}
+
+Shape Shape::torus(const occara::geom::PlaneAxis &axis,
+                   Standard_Real major_radius, Standard_Real minor_radius) {
+  BRepPrimAPI_MakeTorus torus(axis.axis, major_radius, minor_radius);
+  return Shape{torus.Shape()};
+}
+
 // Edge
 
 Edge Edge::from_curve(const occara::geom::TrimmedCurve &curve) {
@@ -100,6 +398,22 @@ Edge EdgeIterator::next() {
   return edge;
 }
 
+// EdgeMap
+
+EdgeMap EdgeMap::create(const Shape &shape) {
+  EdgeMap edge_map;
+  TopExp::MapShapes(shape.shape, TopAbs_EDGE, edge_map.map);
+  return edge_map;
+}
+
+EdgeMap EdgeMap::clone() const { return *this; }
+
+size_t EdgeMap::size() const { return static_cast<size_t>(map.Extent()); }
+
+Edge EdgeMap::at(size_t index) const {
+  return Edge{TopoDS::Edge(map(static_cast<Standard_Integer>(index) + 1))};
+}
+
 // Face
 
 Face Face::clone() const { return *this; }
@@ -108,6 +422,15 @@ Shape Face::extrude(const occara::geom::Vector &vector) const {
   return Shape{BRepPrimAPI_MakePrism(face, vector.vector).Shape()};
 }
 
+Shape Face::revolve(const occara::geom::Axis &axis,
+                    Standard_Real angle) const {
+  return Shape{BRepPrimAPI_MakeRevol(face, axis.axis, angle).Shape()};
+}
+
+Shape Face::sweep(const Wire &spine) const {
+  return Shape{BRepOffsetAPI_MakePipe(spine.wire, face).Shape()};
+}
+
 geom::Surface Face::surface() const {
   return geom::Surface{BRep_Tool::Surface(face)};
 }
@@ -129,14 +452,277 @@ Face FaceIterator::next() {
   return face;
 }
 
+// FaceMap
+
+FaceMap FaceMap::create(const Shape &shape) {
+  FaceMap face_map;
+  TopExp::MapShapes(shape.shape, TopAbs_FACE, face_map.map);
+  return face_map;
+}
+
+FaceMap FaceMap::clone() const { return *this; }
+
+size_t FaceMap::size() const { return static_cast<size_t>(map.Extent()); }
+
+Face FaceMap::at(size_t index) const {
+  return Face{TopoDS::Face(map(static_cast<Standard_Integer>(index) + 1))};
+}
+
+// FaceClassification
+
+FaceClassification FaceClassification::create(const Shape &shape) {
+  FaceClassification classification;
+  TopTools_IndexedMapOfShape faces;
+  TopExp::MapShapes(shape.shape, TopAbs_FACE, faces);
+  const auto count = static_cast<size_t>(faces.Extent());
+  classification.types.reserve(count);
+  classification.origins.assign(count * 3, 0.0);
+  classification.normals.assign(count * 3, 0.0);
+  for (Standard_Integer i = 1; i <= faces.Extent(); ++i) {
+    const TopoDS_Face face = TopoDS::Face(faces(i));
+    Handle(Geom_Surface) surface = BRep_Tool::Surface(face);
+    uint32_t type = 0;
+    if (surface->DynamicType() == STANDARD_TYPE(Geom_Plane)) {
+      type = 1;
+      Handle(Geom_Plane) plane = Handle(Geom_Plane)::DownCast(surface);
+      const gp_Pnt origin = plane->Location();
+      const gp_Dir normal = plane->Pln().Axis().Direction();
+      const size_t offset = static_cast<size_t>(i - 1) * 3;
+      classification.origins[offset] = origin.X();
+      classification.origins[offset + 1] = origin.Y();
+      classification.origins[offset + 2] = origin.Z();
+      classification.normals[offset] = normal.X();
+      classification.normals[offset + 1] = normal.Y();
+      classification.normals[offset + 2] = normal.Z();
+    } else if (surface->DynamicType() ==
+               STANDARD_TYPE(Geom_CylindricalSurface)) {
+      type = 2;
+    } else if (surface->DynamicType() ==
+               STANDARD_TYPE(Geom_SphericalSurface)) {
+      type = 3;
+    } else if (surface->DynamicType() == STANDARD_TYPE(Geom_ConicalSurface)) {
+      type = 4;
+    } else if (surface->DynamicType() == STANDARD_TYPE(Geom_ToroidalSurface)) {
+      type = 5;
+    }
+    classification.types.push_back(type);
+  }
+  return classification;
+}
+
+FaceClassification FaceClassification::clone() const { return *this; }
+
+size_t FaceClassification::size() const { return types.size(); }
+
+const uint32_t *FaceClassification::type_data() const { return types.data(); }
+
+const Standard_Real *FaceClassification::origin_data() const {
+  return origins.data();
+}
+
+const Standard_Real *FaceClassification::normal_data() const {
+  return normals.data();
+}
+
+// BoundingBox
+
+BoundingBox BoundingBox::clone() const { return *this; }
+
+bool BoundingBox::is_void() const { return box.IsVoid() == Standard_True; }
+
+geom::Point BoundingBox::min() const {
+  return geom::Point{box.IsVoid() ? gp_Pnt() : box.CornerMin()};
+}
+
+geom::Point BoundingBox::max() const {
+  return geom::Point{box.IsVoid() ? gp_Pnt() : box.CornerMax()};
+}
+
+bool BoundingBox::intersects(const BoundingBox &other) const {
+  return box.IsOut(other.box) == Standard_False;
+}
+
+// MemoryStats
+
+namespace {
+
+// Flat per-entity figures for the fixed-size kernel classes; close enough
+// for trend analysis, which is all these stats are for.
+constexpr uint64_t kTShapeBytes = 96;
+constexpr uint64_t kAnalyticCurveBytes = 96;
+constexpr uint64_t kAnalyticSurfaceBytes = 128;
+
+uint64_t estimate_curve_bytes(const Handle(Geom_Curve) & curve) {
+  if (curve->DynamicType() == STANDARD_TYPE(Geom_BSplineCurve)) {
+    const Handle(Geom_BSplineCurve) bspline =
+        Handle(Geom_BSplineCurve)::DownCast(curve);
+    // One gp_Pnt plus weight and its share of the knot vector per pole.
+    return static_cast<uint64_t>(bspline->NbPoles()) * 40;
+  }
+  return kAnalyticCurveBytes;
+}
+
+uint64_t estimate_surface_bytes(const Handle(Geom_Surface) & surface) {
+  if (surface->DynamicType() == STANDARD_TYPE(Geom_BSplineSurface)) {
+    const Handle(Geom_BSplineSurface) bspline =
+        Handle(Geom_BSplineSurface)::DownCast(surface);
+    return static_cast<uint64_t>(bspline->NbUPoles()) *
+           static_cast<uint64_t>(bspline->NbVPoles()) * 40;
+  }
+  return kAnalyticSurfaceBytes;
+}
+
+uint64_t estimate_triangulation_bytes(
+    const Handle(Poly_Triangulation) & triangulation) {
+  const uint64_t node_bytes =
+      static_cast<uint64_t>(triangulation->NbNodes()) *
+      (triangulation->HasNormals() ? 36 : 24);
+  return node_bytes + static_cast<uint64_t>(triangulation->NbTriangles()) * 12;
+}
+
+} // namespace
+
+MemoryStats MemoryStats::create(const Shape &shape) {
+  MemoryStats stats;
+
+  TopTools_IndexedMapOfShape all_shapes;
+  TopExp::MapShapes(shape.shape, all_shapes);
+  stats.counts[0] = static_cast<uint64_t>(all_shapes.Extent());
+  stats.byte_estimates[0] = stats.counts[0] * kTShapeBytes;
+
+  // Curves, surfaces and triangulations are shared between sub-shapes, so
+  // deduplicate them by entity address before counting.
+  std::set<const void *> seen;
+
+  TopTools_IndexedMapOfShape edges;
+  TopExp::MapShapes(shape.shape, TopAbs_EDGE, edges);
+  for (Standard_Integer i = 1; i <= edges.Extent(); ++i) {
+    Standard_Real first = 0.0, last = 0.0;
+    const Handle(Geom_Curve) curve =
+        BRep_Tool::Curve(TopoDS::Edge(edges(i)), first, last);
+    if (curve.IsNull() || !seen.insert(curve.get()).second) {
+      continue;
+    }
+    ++stats.counts[1];
+    stats.byte_estimates[1] += estimate_curve_bytes(curve);
+  }
+
+  TopTools_IndexedMapOfShape faces;
+  TopExp::MapShapes(shape.shape, TopAbs_FACE, faces);
+  for (Standard_Integer i = 1; i <= faces.Extent(); ++i) {
+    const TopoDS_Face face = TopoDS::Face(faces(i));
+    const Handle(Geom_Surface) surface = BRep_Tool::Surface(face);
+    if (!surface.IsNull() && seen.insert(surface.get()).second) {
+      ++stats.counts[2];
+      stats.byte_estimates[2] += estimate_surface_bytes(surface);
+    }
+    TopLoc_Location location;
+    const Handle(Poly_Triangulation) triangulation =
+        BRep_Tool::Triangulation(face, location);
+    if (!triangulation.IsNull() && seen.insert(triangulation.get()).second) {
+      ++stats.counts[3];
+      stats.byte_estimates[3] += estimate_triangulation_bytes(triangulation);
+    }
+  }
+
+  return stats;
+}
+
+MemoryStats MemoryStats::clone() const { return *this; }
+
+uint64_t MemoryStats::count(uint32_t category) const {
+  return counts[category];
+}
+
+uint64_t MemoryStats::byte_estimate(uint32_t category) const {
+  return byte_estimates[category];
+}
+
+uint64_t MemoryStats::total_bytes() const {
+  uint64_t total = 0;
+  for (const uint64_t bytes : byte_estimates) {
+    total += bytes;
+  }
+  return total;
+}
+
+// PickResult
+
+PickResult PickResult::clone() const { return *this; }
+
+bool PickResult::is_hit() const { return hit == Standard_True; }
+
+geom::Point PickResult::point() const { return geom::Point{hit_point}; }
+
+Standard_Real PickResult::distance() const { return hit_distance; }
+
+// SpatialIndex
+
+SpatialIndex::SpatialIndex(const Shape &shape) : shape(shape.shape) {
+  intersector.Load(shape.shape, Precision::Confusion());
+}
+
+SpatialIndex SpatialIndex::create(const Shape &shape) {
+  return SpatialIndex(shape);
+}
+
+PickResult SpatialIndex::pick(const geom::Axis &ray) {
+  intersector.PerformNearest(gp_Lin(ray.axis), 0.0, RealLast());
+  PickResult result;
+  if (intersector.IsDone() && intersector.NbPnt() > 0) {
+    result.hit = Standard_True;
+    result.hit_point = intersector.Pnt(1);
+    result.hit_distance = intersector.WParameter(1);
+  }
+  return result;
+}
+
+PickResult SpatialIndex::closest_point(const geom::Point &point) const {
+  BRepExtrema_DistShapeShape extrema(
+      shape, BRepBuilderAPI_MakeVertex(point.point).Vertex());
+  PickResult result;
+  if (extrema.IsDone() && extrema.NbSolution() > 0) {
+    result.hit = Standard_True;
+    result.hit_point = extrema.PointOnShape1(1);
+    result.hit_distance = extrema.Value();
+  }
+  return result;
+}
+
 // Wire
 
 Wire Wire::create(WireBuilder &make_wire) {
   return Wire{make_wire.make_wire.Wire()};
 }
 
+Wire Wire::from_points(const Standard_Real *coordinates, size_t count,
+                       bool closed) {
+  if (count < 2) {
+    // Asking the builder for a wire without any edges would raise
+    // StdFail_NotDone; report the degenerate input as a null wire instead.
+    return Wire{};
+  }
+  BRepBuilderAPI_MakeWire make_wire;
+  for (size_t i = 1; i < count; ++i) {
+    make_wire.Add(BRepBuilderAPI_MakeEdge(
+        gp_Pnt(coordinates[(i - 1) * 3], coordinates[(i - 1) * 3 + 1],
+               coordinates[(i - 1) * 3 + 2]),
+        gp_Pnt(coordinates[i * 3], coordinates[i * 3 + 1],
+               coordinates[i * 3 + 2])));
+  }
+  if (closed && count > 2) {
+    make_wire.Add(BRepBuilderAPI_MakeEdge(
+        gp_Pnt(coordinates[(count - 1) * 3], coordinates[(count - 1) * 3 + 1],
+               coordinates[(count - 1) * 3 + 2]),
+        gp_Pnt(coordinates[0], coordinates[1], coordinates[2])));
+  }
+  return Wire{make_wire.Wire()};
+}
+
 Wire Wire::clone() const { return *this; }
 
+bool Wire::is_null() const { return wire.IsNull(); }
+
 Wire Wire::transform(const occara::geom::Transformation &transformation) const {
   BRepBuilderAPI_Transform transform(wire, transformation.transformation);
   return Wire{TopoDS::Wire(transform.Shape())};
@@ -154,10 +740,105 @@ void WireBuilder::add_edge(const occara::shape::Edge &edge) {
   make_wire.Add(edge.edge);
 }
 
+OperationStatus WireBuilder::try_add_edge(const occara::shape::Edge &edge) {
+  OperationStatus status;
+  guarded(status, [&]() {
+    make_wire.Add(edge.edge);
+    return Shape{};
+  });
+  if (!status.failed && !make_wire.IsDone()) {
+    status.failed = true;
+    status.message = "wire builder could not connect the edge";
+  }
+  return status;
+}
+
 void WireBuilder::add_wire(const occara::shape::Wire &wire) {
   make_wire.Add(wire.wire);
 }
 
+void WireBuilder::add_points(const Standard_Real *coordinates, size_t count) {
+  for (size_t i = 1; i < count; ++i) {
+    make_wire.Add(BRepBuilderAPI_MakeEdge(
+        gp_Pnt(coordinates[(i - 1) * 3], coordinates[(i - 1) * 3 + 1],
+               coordinates[(i - 1) * 3 + 2]),
+        gp_Pnt(coordinates[i * 3], coordinates[i * 3 + 1],
+               coordinates[i * 3 + 2])));
+  }
+}
+
+// ShapeList
+
+ShapeList ShapeList::create() { return ShapeList{}; }
+
+ShapeList ShapeList::clone() const { return *this; }
+
+void ShapeList::add_shape(const Shape &shape) { shapes.Append(shape.shape); }
+
+void ShapeList::add_wire(const Wire &wire) { shapes.Append(wire.wire); }
+
+size_t ShapeList::size() const { return static_cast<size_t>(shapes.Size()); }
+
+// ConstructionContext
+
+ConstructionContext ConstructionContext::create() {
+  return ConstructionContext{new NCollection_IncAllocator()};
+}
+
+ConstructionContext ConstructionContext::clone() const { return *this; }
+
+ShapeList ConstructionContext::make_shape_list() const {
+  return ShapeList{TopTools_ListOfShape(allocator)};
+}
+
+EdgeMap ConstructionContext::make_edge_map(const Shape &shape) const {
+  EdgeMap edge_map{TopTools_IndexedMapOfShape(1, allocator)};
+  TopExp::MapShapes(shape.shape, TopAbs_EDGE, edge_map.map);
+  return edge_map;
+}
+
+FaceMap ConstructionContext::make_face_map(const Shape &shape) const {
+  FaceMap face_map{TopTools_IndexedMapOfShape(1, allocator)};
+  TopExp::MapShapes(shape.shape, TopAbs_FACE, face_map.map);
+  return face_map;
+}
+
+void ConstructionContext::reset() { allocator->Reset(Standard_False); }
+
+// ShapeRegistry
+
+ShapeRegistry ShapeRegistry::create() { return ShapeRegistry{}; }
+
+ShapeRegistry ShapeRegistry::clone() const { return *this; }
+
+Shape ShapeRegistry::intern(const Shape &shape) {
+  const TopLoc_Location location = shape.shape.Location();
+  const TopoDS_Shape candidate = shape.shape.Located(TopLoc_Location());
+  std::ostringstream stream(std::ios::binary);
+  BinTools::Write(candidate, stream);
+  // The canonical bytes double as the exact lookup key, so identical
+  // geometry is shared without risking hash collisions.
+  const auto entry = canonical.emplace(stream.str(), candidate).first;
+  return Shape{
+      entry->second.Located(location).Oriented(shape.shape.Orientation())};
+}
+
+Shape ShapeRegistry::intern_children(const Shape &shape) {
+  if (shape.shape.ShapeType() != TopAbs_COMPOUND) {
+    return intern(shape);
+  }
+  TopoDS_Compound compound;
+  BRep_Builder builder;
+  builder.MakeCompound(compound);
+  for (TopoDS_Iterator iterator(shape.shape); iterator.More();
+       iterator.Next()) {
+    builder.Add(compound, intern(Shape{iterator.Value()}).shape);
+  }
+  return Shape{compound};
+}
+
+size_t ShapeRegistry::unique_count() const { return canonical.size(); }
+
 // Loft
 
 Loft Loft::create_solid() {
@@ -166,13 +847,39 @@ Loft Loft::create_solid() {
 
 Loft Loft::clone() const { return *this; }
 
-void Loft::add_wire(const Wire &wire) { loft.AddWire(wire.wire); }
+void Loft::add_wire(const Wire &wire) {
+  loft.AddWire(wire.wire);
+  ++section_count;
+}
+
+void Loft::add_wires(const ShapeList &sections) {
+  for (const TopoDS_Shape &section : sections.shapes) {
+    if (section.ShapeType() == TopAbs_WIRE) {
+      loft.AddWire(TopoDS::Wire(section));
+      ++section_count;
+    }
+  }
+}
 
 void Loft::ensure_wire_compatibility(Standard_Boolean check) {
   loft.CheckCompatibility(check);
 }
 
-Shape Loft::build() { return Shape{loft.Shape()}; }
+Shape Loft::build() {
+  const telemetry::Stopwatch watch = telemetry::Stopwatch::start();
+  Shape result{loft.Shape()};
+  watch.finish("loft", section_count);
+  return result;
+}
+
+Shape Loft::try_build(OperationStatus &status) {
+  return guarded(status, [this]() { return build(); });
+}
+
+task::PendingShape Loft::build_async() const {
+  return task::run_async(
+      [builder = *this]() mutable { return builder.build().shape; });
+}
 
 // Compound
 
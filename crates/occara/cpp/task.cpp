@@ -0,0 +1,136 @@
+#include "task.hpp"
+#include "shape.hpp"
+#include "Standard_Failure.hxx"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace occara::task {
+
+namespace {
+
+// Fixed-size worker pool shared by all async operations. Workers are started
+// on first use and intentionally leaked, since they may still be draining
+// the queue during static destruction.
+class WorkerPool {
+public:
+  static WorkerPool &instance() {
+    static WorkerPool *pool = new WorkerPool();
+    return *pool;
+  }
+
+  std::shared_future<TopoDS_Shape>
+  submit(std::function<TopoDS_Shape()> operation) {
+    auto packaged = std::make_shared<std::packaged_task<TopoDS_Shape()>>(
+        std::move(operation));
+    std::shared_future<TopoDS_Shape> future = packaged->get_future().share();
+    submit_erased([packaged] { (*packaged)(); });
+    return future;
+  }
+
+  void submit_erased(std::function<void()> operation) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push_back(std::move(operation));
+    }
+    queue_changed.notify_one();
+  }
+
+private:
+  WorkerPool() {
+    const unsigned int count = std::max(1U, std::thread::hardware_concurrency());
+    for (unsigned int i = 0; i < count; ++i) {
+      std::thread([this] { work(); }).detach();
+    }
+  }
+
+  void work() {
+    for (;;) {
+      std::function<void()> operation;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        queue_changed.wait(lock, [this] { return !queue.empty(); });
+        operation = std::move(queue.front());
+        queue.pop_front();
+      }
+      operation();
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable queue_changed;
+  std::deque<std::function<void()>> queue;
+};
+
+// Publishes OpenCASCADE progress updates into a ProgressState and stops the
+// algorithm once the state was cancelled.
+class TrackerIndicator : public Message_ProgressIndicator {
+public:
+  explicit TrackerIndicator(std::shared_ptr<ProgressState> state)
+      : state(std::move(state)) {}
+
+  void Show(const Message_ProgressScope &, const Standard_Boolean) override {
+    state->position.store(GetPosition());
+  }
+
+  Standard_Boolean UserBreak() override { return state->cancelled.load(); }
+
+private:
+  std::shared_ptr<ProgressState> state;
+};
+
+} // namespace
+
+PendingShape run_async(std::function<TopoDS_Shape()> operation) {
+  return PendingShape{WorkerPool::instance().submit(std::move(operation))};
+}
+
+void enqueue(std::function<void()> operation) {
+  WorkerPool::instance().submit_erased(std::move(operation));
+}
+
+// ProgressTracker
+
+ProgressTracker ProgressTracker::create() { return ProgressTracker{}; }
+
+ProgressTracker ProgressTracker::clone() const { return *this; }
+
+Standard_Real ProgressTracker::progress() const {
+  return state->position.load();
+}
+
+void ProgressTracker::cancel() { state->cancelled.store(true); }
+
+bool ProgressTracker::is_cancelled() const { return state->cancelled.load(); }
+
+Handle(Message_ProgressIndicator)
+make_progress_indicator(const ProgressTracker &tracker) {
+  return new TrackerIndicator(tracker.state);
+}
+
+// PendingShape
+
+PendingShape PendingShape::clone() const { return *this; }
+
+bool PendingShape::is_ready() const {
+  return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+occara::shape::Shape PendingShape::wait() const {
+  // An exception thrown inside the worker is stored in the future and
+  // rethrown by get(); convert it into a null shape here so nothing
+  // unwinds across the FFI boundary.
+  try {
+    return occara::shape::Shape{future.get()};
+  } catch (const Standard_Failure &) {
+    return occara::shape::Shape{};
+  } catch (const std::exception &) {
+    return occara::shape::Shape{};
+  }
+}
+
+} // namespace occara::task
@@ -0,0 +1,79 @@
+#include "telemetry.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace {
+
+std::atomic<bool> telemetry_enabled{false};
+
+// Guards the global record buffer; builders may report from worker threads.
+std::mutex &buffer_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<occara::telemetry::Record> &buffer() {
+  static std::vector<occara::telemetry::Record> records;
+  return records;
+}
+
+uint64_t now_nanoseconds() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+} // namespace
+
+namespace occara::telemetry {
+
+// Record
+
+Record Record::clone() const { return *this; }
+
+std::string Record::operation_name() const { return operation; }
+
+Standard_Real Record::milliseconds() const { return duration_ms; }
+
+uint64_t Record::input_size() const { return inputs; }
+
+// RecordList
+
+RecordList RecordList::clone() const { return *this; }
+
+size_t RecordList::size() const { return records.size(); }
+
+Record RecordList::at(size_t index) const { return records[index]; }
+
+void set_enabled(bool enabled) {
+  telemetry_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool is_enabled() {
+  return telemetry_enabled.load(std::memory_order_relaxed);
+}
+
+RecordList drain() {
+  RecordList list;
+  const std::lock_guard<std::mutex> lock(buffer_mutex());
+  list.records.swap(buffer());
+  return list;
+}
+
+// Stopwatch
+
+Stopwatch Stopwatch::start() { return Stopwatch{now_nanoseconds()}; }
+
+void Stopwatch::finish(const std::string &operation, uint64_t inputs) const {
+  if (!is_enabled()) {
+    return;
+  }
+  const Standard_Real duration_ms =
+      static_cast<Standard_Real>(now_nanoseconds() - start_nanoseconds) / 1.e6;
+  const std::lock_guard<std::mutex> lock(buffer_mutex());
+  buffer().push_back(Record{operation, duration_ms, inputs});
+}
+
+} // namespace occara::telemetry
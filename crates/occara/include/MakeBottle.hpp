@@ -4,3 +4,48 @@
 occara::shape::Shape MakeBottle(const Standard_Real theWidth,
                                 const Standard_Real theHeight,
                                 const Standard_Real theThickness);
+
+namespace occara::pipeline {
+
+// Forward declarations
+struct StageCache;
+struct BottlePipeline;
+
+// Cached output of one pipeline stage together with the parameter values the
+// stage consumed when it was last evaluated.
+struct StageCache {
+  TopoDS_Shape shape;
+  Standard_Real first_parameter = 0.0;
+  Standard_Real second_parameter = 0.0;
+  bool valid = false;
+
+  bool up_to_date(Standard_Real first, Standard_Real second) const;
+  void store(const TopoDS_Shape &result, Standard_Real first,
+             Standard_Real second);
+};
+
+// Staged, incrementally recomputable variant of MakeBottle. Every stage
+// caches its TopoDS_Shape keyed on the parameters it consumed, so editing a
+// single parameter only re-evaluates the stages that depend on it (directly
+// or through a recomputed input). This is the model for how CADara feature
+// evaluation is meant to work.
+struct BottlePipeline {
+  StageCache profile;   // width, thickness
+  StageCache body;      // height, prism of profile
+  StageCache filleted;  // thickness (fillet radius)
+  StageCache neck;      // height, thickness
+  StageCache shelled;   // thickness, fuse of filleted body and neck
+  StageCache threading; // height, thickness
+  size_t last_evaluated_stages = 0;
+
+  static BottlePipeline create();
+  BottlePipeline clone() const;
+
+  // Recomputes only the out-of-date stages and returns the assembled bottle.
+  occara::shape::Shape build(Standard_Real width, Standard_Real height,
+                             Standard_Real thickness);
+  // Number of stages (out of six) the last build() actually evaluated.
+  size_t evaluated_stage_count() const;
+};
+
+} // namespace occara::pipeline
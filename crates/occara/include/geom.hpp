@@ -1,6 +1,8 @@
 #pragma once
-#include "GC_MakeArcOfCircle.hxx"
-#include "GC_MakeSegment.hxx"
+// Only the headers of the member types live here; the construction
+// algorithms (GC_*, BRep*) are included by geom.cpp alone, so autocxx and
+// dependent TUs do not parse them.
+#include "Geom2d_Curve.hxx"
 #include "Geom2d_Ellipse.hxx"
 #include "Geom2d_TrimmedCurve.hxx"
 #include "Geom_CylindricalSurface.hxx"
@@ -9,14 +11,22 @@
 #include "Geom_TrimmedCurve.hxx"
 #include "gp_Ax1.hxx"
 #include "gp_Ax2.hxx"
+#include "gp_Ax2d.hxx"
+#include "gp_Ax3.hxx"
+#include "gp_Dir.hxx"
 #include "gp_Dir2d.hxx"
 #include "gp_Pnt.hxx"
 #include "gp_Pnt2d.hxx"
+#include "gp_Trsf.hxx"
+#include "gp_Vec.hxx"
+#include <cstddef>
+#include <vector>
 
 namespace occara::geom {
 
 // Forward declarations
 struct Point;
+struct PointArray;
 struct Point2D;
 struct Vector;
 struct Direction;
@@ -38,6 +48,8 @@ struct Point {
   gp_Pnt point;
 
   static Point create(Standard_Real x, Standard_Real y, Standard_Real z);
+  // Batch constructor: coordinates holds count * 3 values (x, y, z per point).
+  static PointArray create_many(const Standard_Real *coordinates, size_t count);
   Point clone() const;
 
   void get_coordinates(Standard_Real &x, Standard_Real &y,
@@ -47,6 +59,15 @@ struct Point {
   Standard_Real z() const;
 };
 
+struct PointArray {
+  std::vector<gp_Pnt> points;
+
+  PointArray clone() const;
+
+  size_t size() const;
+  Point at(size_t index) const;
+};
+
 struct Point2D {
   gp_Pnt2d point;
 
@@ -114,6 +135,11 @@ struct TrimmedCurve {
                                     const Point &p3);
   static TrimmedCurve line(const Point &p1, const Point &p2);
   TrimmedCurve clone() const;
+
+  // Evaluate count points uniformly spaced in [u_start, u_end] into the
+  // caller-provided buffer of count * 3 values.
+  void sample(Standard_Real u_start, Standard_Real u_end, size_t count,
+              Standard_Real *buffer) const;
 };
 
 struct TrimmedCurve2D {
@@ -121,6 +147,11 @@ struct TrimmedCurve2D {
 
   static TrimmedCurve2D line(const Point2D &p1, const Point2D &p2);
   TrimmedCurve2D clone() const;
+
+  // Evaluate count points uniformly spaced in [u_start, u_end] into the
+  // caller-provided buffer of count * 2 values.
+  void sample(Standard_Real u_start, Standard_Real u_end, size_t count,
+              Standard_Real *buffer) const;
 };
 
 struct Curve2D {
@@ -130,6 +161,9 @@ struct Curve2D {
   Curve2D clone() const;
 
   TrimmedCurve2D trim(Standard_Real u1, Standard_Real u2) const;
+  // See TrimmedCurve2D::sample.
+  void sample(Standard_Real u_start, Standard_Real u_end, size_t count,
+              Standard_Real *buffer) const;
 };
 
 struct Ellipse2D {
@@ -141,6 +175,9 @@ struct Ellipse2D {
 
   Point2D value(Standard_Real u) const;
   Curve2D curve() const;
+  // Batch variant of value: see TrimmedCurve2D::sample.
+  void sample(Standard_Real u_start, Standard_Real u_end, size_t count,
+              Standard_Real *buffer) const;
 };
 
 struct Plane {
@@ -167,6 +204,8 @@ struct Transformation {
   Transformation clone() const;
 
   void mirror(const Axis &axis);
+  void translate(const Vector &vector);
+  void rotate(const Axis &axis, Standard_Real angle);
 };
 
 struct CylindricalSurface {
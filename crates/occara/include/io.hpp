@@ -0,0 +1,81 @@
+#pragma once
+#include "Standard_TypeDef.hxx"
+#include "TopoDS_Shape.hxx"
+#include "task.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace occara::shape {
+struct Shape;
+struct OperationStatus;
+}
+
+namespace occara::io {
+
+// Forward declarations
+struct ShapeData;
+struct ShapeArchive;
+struct StepFile;
+
+// Binary BRep serialization of a Shape (BinTools format), used to checkpoint
+// evaluated geometry so documents can be reopened without replaying the
+// modeling history.
+struct ShapeData {
+  std::vector<char> bytes;
+
+  static ShapeData serialize(const occara::shape::Shape &shape);
+  // Corrupted or truncated bytes are reported through the status together
+  // with a null shape; nothing unwinds across the FFI boundary.
+  static occara::shape::Shape deserialize(const uint8_t *data, size_t size,
+                                          occara::shape::OperationStatus &status);
+  ShapeData clone() const;
+
+  // Stable pointer + length view over the serialized bytes, valid for the
+  // lifetime of the ShapeData.
+  const uint8_t *data() const;
+  size_t size() const;
+};
+
+// Indexed on-disk archive of the sub-shapes of a compound. save() writes one
+// binary BRep record per sub-shape plus an index table; open() reads only the
+// index, and individual records are streamed from disk the first time they
+// are accessed. Opening an archive with hundreds of bodies therefore neither
+// parses nor keeps resident the bodies a session never touches.
+struct ShapeArchive {
+  std::string path;
+  std::vector<uint64_t> offsets;
+  std::vector<uint64_t> sizes;
+  std::vector<TopoDS_Shape> shapes;
+  std::vector<bool> loaded;
+
+  static void save(const occara::shape::Shape &shape, std::string path);
+  static ShapeArchive open(std::string path);
+  ShapeArchive clone() const;
+
+  size_t size() const;
+  bool is_loaded(size_t index) const;
+  // Materializes the sub-shape on first access and caches it afterwards. A
+  // record that cannot be read back (the file was truncated or rewritten
+  // since open()) yields a null shape and is not cached.
+  occara::shape::Shape load(size_t index);
+};
+
+// STEP exchange. Reading transfers all roots and returns them as one shape
+// (a compound when the file has several bodies), with the translator's
+// standard shape healing applied; a failed read reports through the status
+// and returns a null shape. The STEPControl translators keep global state,
+// so all STEP jobs are serialized behind one mutex and calls may overlap
+// freely.
+struct StepFile {
+  static occara::shape::Shape read(std::string path,
+                                   occara::shape::OperationStatus &status);
+  // Parses and translates on the worker pool so an assembly import does not
+  // block the calling thread. A failed import yields a null shape (see
+  // Shape::is_null).
+  static task::PendingShape read_async(std::string path);
+  static bool write(const occara::shape::Shape &shape, std::string path);
+};
+
+} // namespace occara::io
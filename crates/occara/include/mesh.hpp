@@ -0,0 +1,74 @@
+#pragma once
+#include "Standard_TypeDef.hxx"
+#include "TopoDS_Shape.hxx"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace occara::shape {
+struct Shape;
+}
+
+namespace occara::mesh {
+
+// Forward declarations
+struct MeshData;
+struct Mesh;
+struct MeshCache;
+
+struct MeshData {
+  std::vector<Standard_Real> vertices;
+  std::vector<Standard_Real> normals;
+  std::vector<uint32_t> indices;
+  std::vector<uint32_t> face_offsets;
+};
+
+// Triangulation of a shape as flat, contiguous buffers: three values per
+// vertex/normal and three vertex indices per triangle. face_offsets holds,
+// per face of the shape, the index of its first triangle plus one trailing
+// end offset, so face i owns triangles [face_offsets[i], face_offsets[i + 1]).
+// The buffers are shared between copies, like OpenCASCADE handles, so
+// cloning and returning a Mesh is cheap.
+struct Mesh {
+  std::shared_ptr<MeshData> data = std::make_shared<MeshData>();
+
+  static Mesh triangulate(const occara::shape::Shape &shape,
+                          Standard_Real deflection);
+  Mesh clone() const;
+
+  size_t vertex_count() const;
+  size_t triangle_count() const;
+  size_t face_count() const;
+
+  // Stable pointer + length views over the buffers for zero-copy handoff.
+  // The pointers stay valid for the lifetime of the Mesh.
+  const Standard_Real *vertex_data() const;
+  const Standard_Real *normal_data() const;
+  const uint32_t *index_data() const;
+  const uint32_t *face_offset_data() const;
+  size_t face_offset_count() const;
+};
+
+// Level-of-detail cache over Shape::triangulate, keyed by deflection.
+// BRepMesh stores its Poly_Triangulation on the underlying TopoDS_Shape, so
+// meshing further levels of an already-meshed shape reuses that data where
+// the deflection allows. reset() is the invalidation hook to call when the
+// shape was rebuilt.
+struct MeshCache {
+  TopoDS_Shape shape;
+  std::map<Standard_Real, Mesh> levels;
+
+  static MeshCache create(const occara::shape::Shape &shape);
+  MeshCache clone() const;
+
+  // Return the cached mesh for this deflection, triangulating on a miss.
+  Mesh level(Standard_Real deflection);
+  bool has_level(Standard_Real deflection) const;
+  size_t level_count() const;
+  void reset(const occara::shape::Shape &shape);
+  void clear();
+};
+
+} // namespace occara::mesh
@@ -0,0 +1,27 @@
+#pragma once
+// Optional precompiled header for the occara-autocxx-bridge library,
+// enabled by building with OCCARA_PCH=1 (see build.rs). It bundles the
+// wrapper headers with the OCCT algorithm headers that several translation
+// units include, so each of them is parsed once instead of per TU. Keep
+// this list limited to stable, widely shared headers; a rarely used header
+// here slows every rebuild down instead of speeding it up.
+#include "geom.hpp"
+#include "io.hpp"
+#include "mesh.hpp"
+#include "projection.hpp"
+#include "shape.hpp"
+#include "task.hpp"
+#include "telemetry.hpp"
+
+#include "BRepAlgoAPI_Fuse.hxx"
+#include "BRepBuilderAPI_MakeEdge.hxx"
+#include "BRepBuilderAPI_MakeFace.hxx"
+#include "BRepBuilderAPI_Transform.hxx"
+#include "BRepOffsetAPI_MakeThickSolid.hxx"
+#include "BRepPrimAPI_MakeCylinder.hxx"
+#include "BRepPrimAPI_MakePrism.hxx"
+#include "BRep_Tool.hxx"
+#include "GC_MakeArcOfCircle.hxx"
+#include "GC_MakeSegment.hxx"
+#include "Poly_Triangulation.hxx"
+#include "TopoDS.hxx"
@@ -0,0 +1,64 @@
+#pragma once
+#include "geom.hpp"
+#include "shape.hpp"
+#include "task.hpp"
+#include <future>
+
+namespace occara::projection {
+
+// Forward declarations
+struct ProjectedEdges;
+struct PendingProjection;
+struct HiddenLineProjector;
+
+// Planar edge sets produced by one hidden-line projection, grouped by
+// visibility. All edges lie in the Z = 0 plane of the view coordinate
+// system; outlines are the silhouette curves of smooth faces, which have
+// no corresponding model edge.
+struct ProjectedEdges {
+  TopoDS_Shape visible;
+  TopoDS_Shape visible_outlines;
+  TopoDS_Shape hidden;
+  TopoDS_Shape hidden_outlines;
+
+  ProjectedEdges clone() const;
+
+  occara::shape::Shape visible_edges() const;
+  occara::shape::Shape visible_outline_edges() const;
+  occara::shape::Shape hidden_edges() const;
+  occara::shape::Shape hidden_outline_edges() const;
+};
+
+// Handle to a projection running on the worker pool; see
+// task::PendingShape. A projection that failed with a kernel exception
+// yields null edge compounds instead of rethrowing.
+struct PendingProjection {
+  std::shared_future<ProjectedEdges> future;
+
+  PendingProjection clone() const;
+
+  bool is_ready() const;
+  ProjectedEdges wait() const;
+};
+
+// Exact hidden-line-removal projection of a shape for 2D drawing
+// generation. Projecting the B-Rep directly yields true model edges, so
+// no tessellation artifacts end up in the drawing. The algorithm itself is
+// sequential; a drawing with several views should project them
+// concurrently through project_async(), which fans the views out across
+// the worker pool.
+struct HiddenLineProjector {
+  occara::shape::Shape shape;
+
+  static HiddenLineProjector create(const occara::shape::Shape &shape);
+  HiddenLineProjector clone() const;
+
+  // Projects along the Z axis of the view coordinate system.
+  ProjectedEdges project(const occara::geom::PlaneAxis &view) const;
+  PendingProjection project_async(const occara::geom::PlaneAxis &view) const;
+
+  // Internal: shared by project() and project_async().
+  ProjectedEdges project_view(const gp_Ax2 &view) const;
+};
+
+} // namespace occara::projection
@@ -1,53 +1,116 @@
 #pragma once
-#include "BRepBuilderAPI_MakeEdge.hxx"
-#include "BRepBuilderAPI_MakeFace.hxx"
-#include "BRepBuilderAPI_MakeVertex.hxx"
+// Only the headers of the member types live here; the construction
+// algorithms (BRepBuilderAPI_Make*, BRepOffsetAPI_MakeThickSolid,
+// BRepPrimAPI_*, BRep_Tool, ...) are included by shape.cpp alone, so
+// autocxx and dependent TUs do not parse them.
 #include "BRepBuilderAPI_MakeWire.hxx"
-#include "BRepBuilderAPI_Transform.hxx"
 #include "BRepFilletAPI_MakeFillet.hxx"
-#include "BRepOffsetAPI_MakeThickSolid.hxx"
 #include "BRepOffsetAPI_ThruSections.hxx"
-#include "BRepPrimAPI_MakePrism.hxx"
-#include "BRep_Tool.hxx"
+#include "BRep_Builder.hxx"
+#include "Bnd_Box.hxx"
+#include "IntCurvesFace_ShapeIntersector.hxx"
+#include "NCollection_IncAllocator.hxx"
 #include "TopExp_Explorer.hxx"
-#include "TopoDS.hxx"
+#include "TopTools_IndexedMapOfShape.hxx"
+#include "TopTools_ListOfShape.hxx"
+#include "TopoDS_Compound.hxx"
 #include "TopoDS_Edge.hxx"
+#include "TopoDS_Face.hxx"
+#include "TopoDS_Shape.hxx"
 #include "TopoDS_Vertex.hxx"
 #include "TopoDS_Wire.hxx"
 #include "geom.hpp"
+#include "io.hpp"
+#include "mesh.hpp"
+#include "task.hpp"
+#include <string>
+#include <unordered_map>
 
 namespace occara::shape {
 
 // Forward declarations
 struct Vertex;
+struct VertexArray;
 struct FilletBuilder;
 struct ShellBuilder;
 struct Shape;
 struct Edge;
 struct EdgeIterator;
+struct EdgeMap;
 struct Face;
 struct FaceIterator;
+struct FaceMap;
+struct FaceClassification;
+struct PickResult;
+struct SpatialIndex;
+struct BoundingBox;
+struct MemoryStats;
 struct Wire;
 struct WireBuilder;
 struct Loft;
 struct Compound;
+struct ShapeList;
+struct ConstructionContext;
+struct OperationStatus;
+
+// Outcome of a try_ variant. The kernel signals failure by throwing; the
+// try_ variants catch inside C++ and report through this status instead,
+// keeping the FFI boundary exception-free.
+struct OperationStatus {
+  bool failed = false;
+  std::string message;
+
+  OperationStatus clone() const;
+
+  bool is_failure() const;
+  std::string error_message() const;
+};
 
 struct Vertex {
   TopoDS_Vertex vertex;
 
   static Vertex create(const geom::Point &point);
+  // Batch constructor: coordinates holds count * 3 values (x, y, z per vertex).
+  static VertexArray create_many(const Standard_Real *coordinates,
+                                 size_t count);
   Vertex clone() const;
 
   geom::Point point() const;
 };
 
+struct VertexArray {
+  std::vector<TopoDS_Vertex> vertices;
+
+  VertexArray clone() const;
+
+  size_t size() const;
+  Vertex at(size_t index) const;
+};
+
 struct FilletBuilder {
   BRepFilletAPI_MakeFillet make_fillet;
+  task::ProgressTracker progress = task::ProgressTracker::create();
 
   FilletBuilder clone() const;
 
   void add_edge(Standard_Real radius, const Edge &edge);
+  // Bulk selection: add every edge of the shape, or a subset of an EdgeMap
+  // picked by index, with a single call. Indices outside the map are
+  // ignored; the indexed map would throw Standard_OutOfRange for them.
+  void add_all_edges(Standard_Real radius, const Shape &shape);
+  void add_edge_indices(Standard_Real radius, const EdgeMap &edges,
+                        const uint32_t *indices, size_t count);
+  // Report into (and honor cancellation of) the given tracker during
+  // build(). A cancelled build returns a null shape.
+  void track_progress(const task::ProgressTracker &tracker);
   Shape build();
+  // Exception-free variant of build(): kernel failures are caught inside
+  // C++ and reported through status instead of unwinding across the FFI
+  // boundary.
+  Shape try_build(OperationStatus &status);
+  // Runs build() on the worker pool instead of the calling thread. The
+  // builder state is copied, so it can be reused or dropped right away.
+  task::PendingShape build_async() const;
 };
 
 struct ShellBuilder {
@@ -55,14 +118,21 @@ struct ShellBuilder {
   TopTools_ListOfShape faces_to_remove = TopTools_ListOfShape();
   Standard_Real tolerance = 1.e-3;
   Standard_Real offset = 0.0;
+  task::ProgressTracker progress = task::ProgressTracker::create();
 
   static ShellBuilder create(const Shape &shape);
   ShellBuilder clone() const;
 
   void add_face_to_remove(const Face &face);
+  // See FilletBuilder::track_progress.
+  void track_progress(const task::ProgressTracker &tracker);
   void set_offset(Standard_Real offset);
   void set_tolerance(Standard_Real tolerance);
   Shape build();
+  // See FilletBuilder::try_build.
+  Shape try_build(OperationStatus &status);
+  // See FilletBuilder::build_async.
+  task::PendingShape build_async() const;
 };
 
 struct Shape {
@@ -70,10 +140,90 @@ struct Shape {
 
   Shape clone() const;
 
+  // Whether this shape holds no topology. Cancelled and failed builds
+  // return a null shape, which must not be fed into further operations.
+  bool is_null() const;
+
   FilletBuilder fillet() const;
   Shape fuse(const Shape &other) const;
+  // See FilletBuilder::try_build.
+  Shape try_fuse(const Shape &other, OperationStatus &status) const;
+  // n-ary booleans built on the general boolean framework with parallel
+  // execution enabled: one multi-input operation instead of a serial chain
+  // of pairwise operations.
+  static Shape fuse_many(const ShapeList &shapes);
+  Shape cut_many(const ShapeList &tools) const;
+  Shape common_many(const ShapeList &tools) const;
+  // Triangulate all faces with the given linear deflection and return the
+  // result as flat mesh buffers (see mesh.hpp).
+  mesh::Mesh triangulate(Standard_Real deflection) const;
+  // Binary BRep serialization (see io.hpp).
+  io::ShapeData serialize() const;
+  static Shape deserialize(const uint8_t *data, size_t size,
+                           OperationStatus &status);
+  // Indexed sub-shape maps built once via TopExp::MapShapes. Unlike the
+  // iterators they visit shared sub-shapes only once, give O(1) indexed
+  // access, and their indices are stable for selection persistence.
+  EdgeMap edge_map() const;
+  FaceMap face_map() const;
+  // Surface type and planar origin/normal of all faces in one call, instead
+  // of four crossings per face through Face::surface and the Surface API.
+  FaceClassification classify_faces() const;
+  // Reusable acceleration structure for picking and proximity queries (see
+  // SpatialIndex). Building it once amortizes over many queries.
+  SpatialIndex build_bvh() const;
+  // Axis-aligned bounding box, computed on the first call and cached on
+  // this instance. Modelling operations return new Shape values with a
+  // fresh cache, so a stale box cannot outlive a rebuild.
+  BoundingBox aabb() const;
+  // Counts and byte estimates of the kernel entities reachable from this
+  // shape (see MemoryStats).
+  MemoryStats memory_stats() const;
+  // Validity check via BRepCheck with the per-sub-shape checks run in
+  // parallel. Cheap enough to run up front instead of discovering bad
+  // geometry when a fillet or shelling build fails minutes in.
+  bool check() const;
+  // Runs the ShapeFix healing pass over the shape and returns the repaired
+  // result; typically paired with check() after an import or boolean.
+  Shape heal() const;
+  // Instance placed by composing a location over the shared TShape; no
+  // geometry is copied, unlike a BRepBuilderAPI_Transform.
+  Shape moved(const geom::Transformation &transformation) const;
+  // Compound of count instances, instance i placed at the i-th power of
+  // step. With a translation or rotation step this yields linear and
+  // circular patterns in O(count) placements over one shared geometry.
+  Shape pattern(const geom::Transformation &step, size_t count) const;
   static Shape cylinder(const occara::geom::PlaneAxis &axis,
                         Standard_Real radius, Standard_Real height);
+  // Direct primitives, orders of magnitude cheaper than building the same
+  // solids from wires, extrusions and booleans.
+  static Shape cuboid(const occara::geom::Point &corner, Standard_Real dx,
+                      Standard_Real dy, Standard_Real dz);
+  static Shape sphere(const occara::geom::Point &center, Standard_Real radius);
+  // A cone frustum; pass zero for radius2 to get a full cone.
+  static Shape cone(const occara::geom::PlaneAxis &axis, Standard_Real radius1,
+                    Standard_Real radius2, Standard_Real height);
+  static Shape torus(const occara::geom::PlaneAxis &axis,
+                     Standard_Real major_radius, Standard_Real minor_radius);
+
+  // Cache for aabb(); empty until the first query.
+  mutable Bnd_Box cached_aabb = Bnd_Box();
+  mutable Standard_Boolean aabb_cached = Standard_False;
+};
+
+// Axis-aligned bounding box of a shape, cheap enough for view fitting and
+// broad-phase culling without tessellating.
+struct BoundingBox {
+  Bnd_Box box;
+
+  BoundingBox clone() const;
+
+  bool is_void() const;
+  geom::Point min() const;
+  geom::Point max() const;
+  // Broad-phase overlap test: false only if the boxes are guaranteed
+  // disjoint.
+  bool intersects(const BoundingBox &other) const;
 };
 
 struct Edge {
@@ -95,12 +245,26 @@ struct EdgeIterator {
   Edge next();
 };
 
+struct EdgeMap {
+  TopTools_IndexedMapOfShape map;
+
+  static EdgeMap create(const Shape &shape);
+  EdgeMap clone() const;
+
+  size_t size() const;
+  Edge at(size_t index) const;
+};
+
 struct Face {
   TopoDS_Face face;
 
   Face clone() const;
 
   Shape extrude(const occara::geom::Vector &vector) const;
+  // Solid of revolution of this face around the axis, angle in radians.
+  Shape revolve(const occara::geom::Axis &axis, Standard_Real angle) const;
+  // Sweep this face along the spine wire.
+  Shape sweep(const Wire &spine) const;
   geom::Surface surface() const;
 };
 
@@ -114,12 +278,103 @@ struct FaceIterator {
   Face next();
 };
 
+struct FaceMap {
+  TopTools_IndexedMapOfShape map;
+
+  static FaceMap create(const Shape &shape);
+  FaceMap clone() const;
+
+  size_t size() const;
+  Face at(size_t index) const;
+};
+
+// Surface classification of every face of a shape, computed in one pass and
+// indexed like FaceMap. types holds one value per face (0 other, 1 plane,
+// 2 cylinder, 3 sphere, 4 cone, 5 torus); origins and normals hold three
+// values per face and are only meaningful for planar faces.
+struct FaceClassification {
+  std::vector<uint32_t> types;
+  std::vector<Standard_Real> origins;
+  std::vector<Standard_Real> normals;
+
+  static FaceClassification create(const Shape &shape);
+  FaceClassification clone() const;
+
+  size_t size() const;
+  const uint32_t *type_data() const;
+  const Standard_Real *origin_data() const;
+  const Standard_Real *normal_data() const;
+};
+
+// Memory footprint of a shape, per kernel category (0 TShape nodes,
+// 1 curves, 2 surfaces, 3 triangulations). Entities shared between
+// sub-shapes are counted once, so the stats of a compound aggregate its
+// children without double counting. The byte figures are estimates from
+// entity counts and pole/node sizes, not allocator measurements; they are
+// meant for comparing categories and revisions, not for exact accounting.
+struct MemoryStats {
+  std::vector<uint64_t> counts = std::vector<uint64_t>(4, 0);
+  std::vector<uint64_t> byte_estimates = std::vector<uint64_t>(4, 0);
+
+  static MemoryStats create(const Shape &shape);
+  MemoryStats clone() const;
+
+  uint64_t count(uint32_t category) const;
+  uint64_t byte_estimate(uint32_t category) const;
+  uint64_t total_bytes() const;
+};
+
+// Result of a SpatialIndex query. For pick() the distance is the ray
+// parameter of the nearest intersection; for closest_point() it is the
+// euclidean distance from the query point to the shape.
+struct PickResult {
+  Standard_Boolean hit = Standard_False;
+  gp_Pnt hit_point = gp_Pnt();
+  Standard_Real hit_distance = 0.0;
+
+  PickResult clone() const;
+
+  bool is_hit() const;
+  geom::Point point() const;
+  Standard_Real distance() const;
+};
+
+// Spatial index over the faces of a shape. Loading the face intersector
+// once builds its bounding volume hierarchy up front, so repeated queries
+// avoid the exhaustive iteration of the explorer API.
+struct SpatialIndex {
+  TopoDS_Shape shape;
+  IntCurvesFace_ShapeIntersector intersector;
+
+  explicit SpatialIndex(const Shape &shape);
+  static SpatialIndex create(const Shape &shape);
+  // Disable copy and move, since the intersector caches per-face state
+  // tied to this instance
+  SpatialIndex(const SpatialIndex &) = delete;
+  SpatialIndex &operator=(const SpatialIndex &) = delete;
+  SpatialIndex(SpatialIndex &&) = delete;
+  SpatialIndex &operator=(SpatialIndex &&) = delete;
+
+  // Nearest intersection of the ray with the shape, in front of the ray
+  // origin only.
+  PickResult pick(const geom::Axis &ray);
+  PickResult closest_point(const geom::Point &point) const;
+};
+
 struct Wire {
   TopoDS_Wire wire;
 
   static Wire create(WireBuilder &make_wire);
+  // One-shot polyline builder: coordinates holds count * 3 values
+  // (x, y, z per point). If closed, a segment from the last point back to
+  // the first is added as well. Fewer than two points yield a null wire,
+  // since no segment can be built from them.
+  static Wire from_points(const Standard_Real *coordinates, size_t count,
+                          bool closed);
   Wire clone() const;
 
+  bool is_null() const;
+
   Wire transform(const occara::geom::Transformation &transformation) const;
   Face face() const;
   void build_curves_3d();
@@ -131,18 +386,86 @@ struct WireBuilder {
   WireBuilder clone() const;
 
   void add_edge(const occara::shape::Edge &edge);
+  // Exception-free variant of add_edge: a rejected or non-connectable edge
+  // is reported through the returned status instead of a crash.
+  OperationStatus try_add_edge(const occara::shape::Edge &edge);
   void add_wire(const occara::shape::Wire &wire);
+  // Bulk variant of add_edge: builds one segment edge between each pair of
+  // consecutive points and adds them all in a single call.
+  void add_points(const Standard_Real *coordinates, size_t count);
+};
+
+struct ShapeList {
+  TopTools_ListOfShape shapes;
+
+  static ShapeList create();
+  ShapeList clone() const;
+
+  void add_shape(const Shape &shape);
+  void add_wire(const Wire &wire);
+  size_t size() const;
+};
+
+// Arena for the transient containers churned through during one feature
+// evaluation. The NCollection containers can draw their nodes from an
+// incremental allocator, which turns many small heap allocations into
+// pointer bumps within large blocks; reset() releases them all at once at
+// rebuild end and keeps the blocks for the next rebuild. Kernel geometry
+// itself (Geom_* entities, TShapes) is reference counted and cannot live
+// in an arena.
+struct ConstructionContext {
+  Handle(NCollection_IncAllocator) allocator;
+
+  static ConstructionContext create();
+  // The clone shares the arena, like the handle semantics of the kernel.
+  ConstructionContext clone() const;
+
+  // Variants of ShapeList::create and Shape::edge_map/face_map whose nodes
+  // and buckets live in this arena.
+  ShapeList make_shape_list() const;
+  EdgeMap make_edge_map(const Shape &shape) const;
+  FaceMap make_face_map(const Shape &shape) const;
+  // Bulk release of everything allocated from this context. Lists and maps
+  // handed out earlier must not be used afterwards.
+  void reset();
+};
+
+// Content-addressed interning registry. intern() detects shapes whose
+// location-free geometry is identical (keyed by their canonical binary BRep
+// form) and rewrites further instances to share the first instance's
+// underlying TShape, keeping only their own location and orientation.
+// Fastener-heavy assemblies then store each repeated part's geometry once.
+struct ShapeRegistry {
+  std::unordered_map<std::string, TopoDS_Shape> canonical;
+
+  static ShapeRegistry create();
+  ShapeRegistry clone() const;
+
+  Shape intern(const Shape &shape);
+  // Rebuilds a compound with every direct sub-shape interned; other shapes
+  // behave like intern().
+  Shape intern_children(const Shape &shape);
+  size_t unique_count() const;
 };
 
 struct Loft {
   BRepOffsetAPI_ThruSections loft;
+  // Only used by the telemetry report of build().
+  uint64_t section_count = 0;
 
   static Loft create_solid();
   Loft clone() const;
 
   void add_wire(const Wire &wire);
+  // Bulk variant of add_wire: appends every wire in the list with a single
+  // call. Entries that are not wires are ignored.
+  void add_wires(const ShapeList &sections);
   void ensure_wire_compatibility(Standard_Boolean check);
   Shape build();
+  // See FilletBuilder::try_build.
+  Shape try_build(OperationStatus &status);
+  // See FilletBuilder::build_async.
+  task::PendingShape build_async() const;
 };
 
 struct Compound {
@@ -0,0 +1,68 @@
+#pragma once
+#include "Message_ProgressIndicator.hxx"
+#include "TopoDS_Shape.hxx"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+
+namespace occara::shape {
+struct Shape;
+}
+
+namespace occara::task {
+
+// Forward declarations
+struct ProgressState;
+struct ProgressTracker;
+struct PendingShape;
+
+// Shared between a running operation and the code observing it.
+struct ProgressState {
+  std::atomic<Standard_Real> position{0.0};
+  std::atomic<bool> cancelled{false};
+};
+
+// Progress and cancellation token for long-running builders. The tracker is
+// handed to a builder before build() and can then be polled (or cancelled)
+// from any thread while the operation runs; a cancelled operation aborts at
+// the next progress checkpoint inside OpenCASCADE.
+struct ProgressTracker {
+  std::shared_ptr<ProgressState> state = std::make_shared<ProgressState>();
+
+  static ProgressTracker create();
+  ProgressTracker clone() const;
+
+  // Completed fraction of the running operation, in [0, 1].
+  Standard_Real progress() const;
+  void cancel();
+  bool is_cancelled() const;
+};
+
+// Internal: progress indicator publishing into the tracker's shared state.
+Handle(Message_ProgressIndicator)
+make_progress_indicator(const ProgressTracker &tracker);
+
+// Handle to a modeling operation running on the shared worker pool.
+// Poll with is_ready() or block with wait(); the handle can be cloned and
+// waited on from several places, like an OpenCASCADE handle. An operation
+// that failed with a kernel exception yields a null shape (see
+// Shape::is_null) instead of rethrowing across the FFI boundary.
+struct PendingShape {
+  std::shared_future<TopoDS_Shape> future;
+
+  PendingShape clone() const;
+
+  bool is_ready() const;
+  occara::shape::Shape wait() const;
+};
+
+// Enqueue an operation on the worker pool. Only used internally by the
+// build_async() variants of the builder types; not exposed to Rust.
+PendingShape run_async(std::function<TopoDS_Shape()> operation);
+
+// Internal: enqueue a type-erased operation on the worker pool, for async
+// results that are not a single shape (see projection::PendingProjection).
+void enqueue(std::function<void()> operation);
+
+} // namespace occara::task
@@ -0,0 +1,58 @@
+#pragma once
+#include "Standard_TypeDef.hxx"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace occara::telemetry {
+
+// Forward declarations
+struct Record;
+struct RecordList;
+struct Stopwatch;
+
+// One timed kernel operation. inputs is operation specific: the number of
+// tool shapes for booleans, contours for fillets, removed faces for
+// shelling, sections for lofts and evaluated stages for the bottle
+// pipeline.
+struct Record {
+  std::string operation;
+  Standard_Real duration_ms = 0.0;
+  uint64_t inputs = 0;
+
+  Record clone() const;
+
+  std::string operation_name() const;
+  Standard_Real milliseconds() const;
+  uint64_t input_size() const;
+};
+
+struct RecordList {
+  std::vector<Record> records;
+
+  RecordList clone() const;
+
+  size_t size() const;
+  Record at(size_t index) const;
+};
+
+// Telemetry is off by default; a disabled instrumented entry point costs a
+// single atomic load.
+void set_enabled(bool enabled);
+bool is_enabled();
+// Moves all records collected so far out of the global buffer. Consumers
+// poll this instead of registering callbacks, which cannot cross the
+// autocxx boundary.
+RecordList drain();
+
+// Wall-clock timer for an instrumented entry point.
+struct Stopwatch {
+  uint64_t start_nanoseconds = 0;
+
+  static Stopwatch start();
+  // Appends a record with the elapsed wall time, if telemetry is enabled.
+  void finish(const std::string &operation, uint64_t inputs) const;
+};
+
+} // namespace occara::telemetry
@@ -10,6 +10,11 @@
 autocxx::include_cpp! {
     #include "shape.hpp"
     #include "geom.hpp"
+    #include "io.hpp"
+    #include "mesh.hpp"
+    #include "projection.hpp"
+    #include "task.hpp"
+    #include "telemetry.hpp"
     #include "MakeBottle.hpp"
     safety!(unsafe)
     generate_ns!("occara")
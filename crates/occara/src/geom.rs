@@ -33,6 +33,14 @@ impl Point {
         (x, y, z)
     }
 
+    #[must_use]
+    pub fn new_many(coordinates: &[[f64; 3]]) -> PointArray {
+        PointArray(
+            ffi_geom::Point::create_many(coordinates.as_ptr().cast::<f64>(), coordinates.len())
+                .within_box(),
+        )
+    }
+
     #[must_use]
     pub fn origin() -> Self {
         Self::new(0.0, 0.0, 0.0)
@@ -55,6 +63,31 @@ impl Clone for Point {
     }
 }
 
+pub struct PointArray(pub(crate) Pin<Box<ffi_geom::PointArray>>);
+
+impl PointArray {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    #[must_use]
+    pub fn get(&self, index: usize) -> Option<Point> {
+        (index < self.len()).then(|| Point(self.0.at(index).within_box()))
+    }
+}
+
+impl Clone for PointArray {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
 pub struct Direction(pub(crate) Pin<Box<ffi_geom::Direction>>);
 
 impl Direction {
@@ -224,6 +257,17 @@ impl TrimmedCurve {
     pub fn line(p1: &Point, p2: &Point) -> Self {
         Self(ffi_geom::TrimmedCurve::line(&p1.0, &p2.0).within_box())
     }
+
+    /// Evaluate `buffer.len()` points uniformly spaced in `[u_start, u_end]`
+    /// into `buffer`, with a single FFI crossing.
+    pub fn sample(&self, u_start: f64, u_end: f64, buffer: &mut [[f64; 3]]) {
+        self.0.sample(
+            u_start,
+            u_end,
+            buffer.len(),
+            buffer.as_mut_ptr().cast::<f64>(),
+        );
+    }
 }
 
 impl Clone for TrimmedCurve {
@@ -239,6 +283,16 @@ impl TrimmedCurve2D {
     pub fn line(p1: &Point2D, p2: &Point2D) -> Self {
         Self(ffi_geom::TrimmedCurve2D::line(&p1.0, &p2.0).within_box())
     }
+
+    /// See [`TrimmedCurve::sample`].
+    pub fn sample(&self, u_start: f64, u_end: f64, buffer: &mut [[f64; 2]]) {
+        self.0.sample(
+            u_start,
+            u_end,
+            buffer.len(),
+            buffer.as_mut_ptr().cast::<f64>(),
+        );
+    }
 }
 
 impl Clone for TrimmedCurve2D {
@@ -255,6 +309,16 @@ impl Curve2D {
         let trimmed_curve = ffi_geom::Curve2D::trim(&self.0, u1, u2).within_box();
         TrimmedCurve2D(trimmed_curve)
     }
+
+    /// See [`TrimmedCurve::sample`].
+    pub fn sample(&self, u_start: f64, u_end: f64, buffer: &mut [[f64; 2]]) {
+        self.0.sample(
+            u_start,
+            u_end,
+            buffer.len(),
+            buffer.as_mut_ptr().cast::<f64>(),
+        );
+    }
 }
 
 impl From<&TrimmedCurve2D> for Curve2D {
@@ -287,6 +351,16 @@ impl Ellipse2D {
     pub fn curve(&self) -> Curve2D {
         Curve2D(self.0.curve().within_box())
     }
+
+    /// Batch variant of [`Ellipse2D::value`]: see [`TrimmedCurve::sample`].
+    pub fn sample(&self, u_start: f64, u_end: f64, buffer: &mut [[f64; 2]]) {
+        self.0.sample(
+            u_start,
+            u_end,
+            buffer.len(),
+            buffer.as_mut_ptr().cast::<f64>(),
+        );
+    }
 }
 
 impl Clone for Ellipse2D {
@@ -352,6 +426,20 @@ impl Transformation {
         Self(transformation)
     }
 
+    #[must_use]
+    pub fn translation(vector: &Vector) -> Self {
+        let mut transformation = ffi_geom::Transformation::new().within_box();
+        transformation.as_mut().translate(&vector.0);
+        Self(transformation)
+    }
+
+    #[must_use]
+    pub fn rotation(axis: &Axis, angle: f64) -> Self {
+        let mut transformation = ffi_geom::Transformation::new().within_box();
+        transformation.as_mut().rotate(&axis.0, angle);
+        Self(transformation)
+    }
+
     #[must_use]
     pub fn apply<T: Transformable>(&self, object: &T) -> T {
         object.transform(self)
@@ -0,0 +1,142 @@
+use crate::ffi::occara::io as ffi_io;
+use crate::shape::Shape;
+use autocxx::prelude::*;
+use std::pin::Pin;
+
+/// Binary BRep serialization of a [`Shape`].
+pub struct ShapeData(pub(crate) Pin<Box<ffi_io::ShapeData>>);
+
+impl ShapeData {
+    /// The serialized bytes, borrowed without a copy.
+    #[must_use]
+    pub fn bytes(&self) -> &[u8] {
+        let (data, len) = (self.0.data(), self.0.size());
+        if data.is_null() || len == 0 {
+            &[]
+        } else {
+            // SAFETY: pointer and length describe the same C++ vector, which
+            // lives as long as `self` and is never mutated through this
+            // wrapper.
+            unsafe { std::slice::from_raw_parts(data, len) }
+        }
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+impl Clone for ShapeData {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Indexed on-disk archive over the sub-shapes of a compound. Opening an
+/// archive only reads its index; each sub-shape is streamed from disk the
+/// first time it is requested and cached afterwards.
+pub struct ShapeArchive(pub(crate) Pin<Box<ffi_io::ShapeArchive>>);
+
+impl ShapeArchive {
+    /// Writes one record per direct sub-shape of `shape` plus an index table.
+    pub fn save(shape: &Shape, path: &str) {
+        ffi_io::ShapeArchive::save(&shape.0, path);
+    }
+
+    #[must_use]
+    pub fn open(path: &str) -> Self {
+        Self(ffi_io::ShapeArchive::open(path).within_box())
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Whether the sub-shape at `index` is already resident; `false` for
+    /// out-of-range indices.
+    #[must_use]
+    pub fn is_loaded(&self, index: usize) -> bool {
+        self.0.is_loaded(index)
+    }
+
+    /// Materializes the sub-shape at `index`, reading it from disk on first
+    /// access. Returns `None` for out-of-range indices and for records that
+    /// cannot be read back, e.g. when the file was truncated since
+    /// [`ShapeArchive::open`].
+    #[must_use]
+    pub fn load(&mut self, index: usize) -> Option<Shape> {
+        if index >= self.len() {
+            return None;
+        }
+        let shape = Shape(self.0.as_mut().load(index).within_box());
+        (!shape.is_null()).then_some(shape)
+    }
+}
+
+impl Clone for ShapeArchive {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// STEP exchange. Reading transfers all roots of the file and returns them
+/// as one shape (a compound when the file holds several bodies), with the
+/// translator's standard shape healing applied. The underlying translators
+/// keep global state, so all STEP jobs are serialized in C++; calls may
+/// overlap freely.
+pub struct StepFile;
+
+impl StepFile {
+    /// Returns an error when the file cannot be read or holds no
+    /// translatable roots.
+    pub fn read(path: &str) -> Result<Shape, String> {
+        let mut status = crate::ffi::occara::shape::OperationStatus::new().within_box();
+        let shape = Shape(ffi_io::StepFile::read(path, status.as_mut()).within_box());
+        crate::shape::status_to_result(&status).map(|()| shape)
+    }
+
+    /// Parses and translates on the C++ worker pool so an assembly import
+    /// does not block the calling thread. A failed import yields a null
+    /// shape, see [`Shape::is_null`].
+    #[must_use]
+    pub fn read_async(path: &str) -> crate::task::PendingShape {
+        crate::task::PendingShape(ffi_io::StepFile::read_async(path).within_box())
+    }
+
+    /// Returns `false` if the shape could not be translated or written.
+    pub fn write(shape: &Shape, path: &str) -> bool {
+        ffi_io::StepFile::write(&shape.0, path)
+    }
+}
+
+impl Shape {
+    /// Serializes the shape into the binary BRep format.
+    #[must_use]
+    pub fn serialize(&self) -> ShapeData {
+        ShapeData(self.0.serialize().within_box())
+    }
+
+    /// Restores a shape previously written by [`Shape::serialize`].
+    /// Corrupted or truncated bytes are reported as an error instead of
+    /// unwinding across the FFI boundary.
+    pub fn deserialize(bytes: &[u8]) -> Result<Self, String> {
+        let mut status = crate::ffi::occara::shape::OperationStatus::new().within_box();
+        let shape = Self(
+            ffi_io::ShapeData::deserialize(bytes.as_ptr(), bytes.len(), status.as_mut())
+                .within_box(),
+        );
+        crate::shape::status_to_result(&status).map(|()| shape)
+    }
+}
@@ -6,7 +6,12 @@
 mod ffi;
 
 pub mod geom;
+pub mod io;
+pub mod mesh;
+pub mod projection;
 pub mod shape;
+pub mod task;
+pub mod telemetry;
 
 #[doc(hidden)]
 pub mod internal {
@@ -19,4 +24,36 @@ pub mod internal {
     pub fn make_bottle_cpp(width: f64, height: f64, thickness: f64) -> crate::shape::Shape {
         crate::shape::Shape(crate::ffi::MakeBottle(width, height, thickness).within_box())
     }
+
+    // Staged variant of make_bottle_cpp that caches intermediate shapes, so
+    // rebuilding after a single-parameter change only re-evaluates the stages
+    // depending on that parameter.
+    #[doc(hidden)]
+    pub struct BottlePipeline(std::pin::Pin<Box<crate::ffi::occara::pipeline::BottlePipeline>>);
+
+    impl BottlePipeline {
+        #[doc(hidden)]
+        #[must_use]
+        pub fn new() -> Self {
+            Self(crate::ffi::occara::pipeline::BottlePipeline::create().within_box())
+        }
+
+        #[doc(hidden)]
+        #[must_use]
+        pub fn build(&mut self, width: f64, height: f64, thickness: f64) -> crate::shape::Shape {
+            crate::shape::Shape(self.0.as_mut().build(width, height, thickness).within_box())
+        }
+
+        #[doc(hidden)]
+        #[must_use]
+        pub fn evaluated_stage_count(&self) -> usize {
+            self.0.evaluated_stage_count()
+        }
+    }
+
+    impl Default for BottlePipeline {
+        fn default() -> Self {
+            Self::new()
+        }
+    }
 }
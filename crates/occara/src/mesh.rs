@@ -0,0 +1,112 @@
+use crate::ffi::occara::mesh as ffi_mesh;
+use crate::shape::Shape;
+use autocxx::prelude::*;
+use std::pin::Pin;
+
+pub struct Mesh(pub(crate) Pin<Box<ffi_mesh::Mesh>>);
+
+impl Mesh {
+    #[must_use]
+    pub fn vertex_count(&self) -> usize {
+        self.0.vertex_count()
+    }
+
+    #[must_use]
+    pub fn triangle_count(&self) -> usize {
+        self.0.triangle_count()
+    }
+
+    #[must_use]
+    pub fn face_count(&self) -> usize {
+        self.0.face_count()
+    }
+
+    /// Vertex coordinates, three values per vertex, borrowed without a copy.
+    #[must_use]
+    pub fn vertices(&self) -> &[f64] {
+        // SAFETY: pointer and length describe the same C++ vector, which lives
+        // as long as `self` and is never mutated through this wrapper.
+        unsafe { slice_or_empty(self.0.vertex_data(), self.0.vertex_count() * 3) }
+    }
+
+    /// Vertex normals, three values per vertex, borrowed without a copy.
+    #[must_use]
+    pub fn normals(&self) -> &[f64] {
+        // SAFETY: see `vertices`.
+        unsafe { slice_or_empty(self.0.normal_data(), self.0.vertex_count() * 3) }
+    }
+
+    /// Triangle vertex indices, three per triangle, borrowed without a copy.
+    #[must_use]
+    pub fn indices(&self) -> &[u32] {
+        // SAFETY: see `vertices`.
+        unsafe { slice_or_empty(self.0.index_data(), self.0.triangle_count() * 3) }
+    }
+
+    /// Per-face triangle ranges: face `i` owns triangles
+    /// `face_offsets()[i]..face_offsets()[i + 1]`.
+    #[must_use]
+    pub fn face_offsets(&self) -> &[u32] {
+        // SAFETY: see `vertices`.
+        unsafe { slice_or_empty(self.0.face_offset_data(), self.0.face_offset_count()) }
+    }
+}
+
+pub struct MeshCache(pub(crate) Pin<Box<ffi_mesh::MeshCache>>);
+
+impl MeshCache {
+    #[must_use]
+    pub fn new(shape: &Shape) -> Self {
+        Self(ffi_mesh::MeshCache::create(&shape.0).within_box())
+    }
+
+    /// Returns the mesh for this deflection, triangulating it on a cache miss.
+    /// Cache hits share their buffers with the stored mesh instead of copying.
+    #[must_use]
+    pub fn level(&mut self, deflection: f64) -> Mesh {
+        Mesh(self.0.as_mut().level(deflection).within_box())
+    }
+
+    #[must_use]
+    pub fn has_level(&self, deflection: f64) -> bool {
+        self.0.has_level(deflection)
+    }
+
+    #[must_use]
+    pub fn level_count(&self) -> usize {
+        self.0.level_count()
+    }
+
+    /// Invalidates all cached levels and re-targets the cache at the given
+    /// (typically rebuilt) shape.
+    pub fn reset(&mut self, shape: &Shape) {
+        self.0.as_mut().reset(&shape.0);
+    }
+
+    /// Invalidates all cached levels.
+    pub fn clear(&mut self) {
+        self.0.as_mut().clear();
+    }
+}
+
+impl Clone for MeshCache {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+// An empty C++ vector may hand out a null data pointer, which
+// `slice::from_raw_parts` does not allow even for length zero.
+pub(crate) unsafe fn slice_or_empty<'a, T>(data: *const T, len: usize) -> &'a [T] {
+    if data.is_null() || len == 0 {
+        &[]
+    } else {
+        unsafe { std::slice::from_raw_parts(data, len) }
+    }
+}
+
+impl Clone for Mesh {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
@@ -0,0 +1,97 @@
+use crate::ffi::occara::projection as ffi_projection;
+use crate::geom::PlaneAxis;
+use crate::shape::Shape;
+use autocxx::prelude::*;
+use std::pin::Pin;
+
+/// Exact hidden-line-removal projection of a shape, for generating 2D
+/// drawings. The B-Rep is projected directly, so the drawing contains true
+/// model edges instead of tessellation artifacts. One projection runs
+/// sequentially; project the views of a drawing concurrently with
+/// [`HiddenLineProjector::project_async`], which fans them out across the
+/// worker pool.
+pub struct HiddenLineProjector(pub(crate) Pin<Box<ffi_projection::HiddenLineProjector>>);
+
+impl HiddenLineProjector {
+    #[must_use]
+    pub fn new(shape: &Shape) -> Self {
+        Self(ffi_projection::HiddenLineProjector::create(&shape.0).within_box())
+    }
+
+    /// Projects along the Z axis of the view coordinate system.
+    #[must_use]
+    pub fn project(&self, view: &PlaneAxis) -> ProjectedEdges {
+        ProjectedEdges(self.0.project(&view.0).within_box())
+    }
+
+    /// Runs the projection on the worker pool without blocking the calling
+    /// thread.
+    #[must_use]
+    pub fn project_async(&self, view: &PlaneAxis) -> PendingProjection {
+        PendingProjection(self.0.project_async(&view.0).within_box())
+    }
+}
+
+impl Clone for HiddenLineProjector {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Edge sets of one projection, grouped by visibility. All edges lie in the
+/// Z = 0 plane of the view coordinate system; outlines are the silhouette
+/// curves of smooth faces, which have no corresponding model edge.
+pub struct ProjectedEdges(pub(crate) Pin<Box<ffi_projection::ProjectedEdges>>);
+
+impl ProjectedEdges {
+    #[must_use]
+    pub fn visible_edges(&self) -> Shape {
+        Shape(self.0.visible_edges().within_box())
+    }
+
+    #[must_use]
+    pub fn visible_outline_edges(&self) -> Shape {
+        Shape(self.0.visible_outline_edges().within_box())
+    }
+
+    #[must_use]
+    pub fn hidden_edges(&self) -> Shape {
+        Shape(self.0.hidden_edges().within_box())
+    }
+
+    #[must_use]
+    pub fn hidden_outline_edges(&self) -> Shape {
+        Shape(self.0.hidden_outline_edges().within_box())
+    }
+}
+
+impl Clone for ProjectedEdges {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Handle to a projection running on the C++ worker pool; see
+/// [`crate::task::PendingShape`].
+pub struct PendingProjection(pub(crate) Pin<Box<ffi_projection::PendingProjection>>);
+
+impl PendingProjection {
+    #[must_use]
+    pub fn is_ready(&self) -> bool {
+        self.0.is_ready()
+    }
+
+    /// Blocks until the projection has finished and returns its result. A
+    /// projection that failed with a kernel exception yields null edge
+    /// compounds, see [`Shape::is_null`].
+    #[must_use]
+    pub fn wait(&self) -> ProjectedEdges {
+        ProjectedEdges(self.0.wait().within_box())
+    }
+}
+
+impl Clone for PendingProjection {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
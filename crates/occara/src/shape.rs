@@ -11,6 +11,14 @@ impl Vertex {
         Self(ffi_shape::Vertex::create(&point.0.as_ref()).within_box())
     }
 
+    #[must_use]
+    pub fn from_points(coordinates: &[[f64; 3]]) -> VertexArray {
+        VertexArray(
+            ffi_shape::Vertex::create_many(coordinates.as_ptr().cast::<f64>(), coordinates.len())
+                .within_box(),
+        )
+    }
+
     #[must_use]
     pub fn point(&self) -> geom::Point {
         geom::Point(self.0.point().within_box())
@@ -43,9 +51,42 @@ impl Clone for Vertex {
     }
 }
 
+pub struct VertexArray(pub(crate) Pin<Box<ffi_shape::VertexArray>>);
+
+impl VertexArray {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    #[must_use]
+    pub fn get(&self, index: usize) -> Option<Vertex> {
+        (index < self.len()).then(|| Vertex(self.0.at(index).within_box()))
+    }
+}
+
+impl Clone for VertexArray {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
 pub struct Shape(pub(crate) Pin<Box<ffi_shape::Shape>>);
 
 impl Shape {
+    /// Whether this shape holds no topology. Cancelled or failed builds
+    /// (see [`FilletBuilder::build`]) return a null shape; check before
+    /// feeding the result into further operations.
+    #[must_use]
+    pub fn is_null(&self) -> bool {
+        self.0.is_null()
+    }
+
     #[must_use]
     pub fn fillet(&self) -> FilletBuilder {
         FilletBuilder(ffi_shape::Shape::fillet(&self.0).within_box())
@@ -61,11 +102,114 @@ impl Shape {
         FaceIterator(ffi_shape::FaceIterator::create(&self.0).within_box())
     }
 
+    /// Indexed edge map built once in C++. Unlike [`Shape::edges`] it visits
+    /// shared edges only once and its indices are stable, which makes them
+    /// suitable for selection persistence.
+    #[must_use]
+    pub fn edge_map(&self) -> EdgeMap {
+        EdgeMap(self.0.edge_map().within_box())
+    }
+
+    /// Indexed face map, see [`Shape::edge_map`].
+    #[must_use]
+    pub fn face_map(&self) -> FaceMap {
+        FaceMap(self.0.face_map().within_box())
+    }
+
+    /// Surface type and planar origin/normal of all faces, collected in a
+    /// single call.
+    #[must_use]
+    pub fn classify_faces(&self) -> FaceClassification {
+        FaceClassification(self.0.classify_faces().within_box())
+    }
+
+    /// Build a reusable spatial index over the faces for picking and
+    /// proximity queries.
+    #[must_use]
+    pub fn build_bvh(&self) -> SpatialIndex {
+        SpatialIndex::new(self)
+    }
+
+    /// Axis-aligned bounding box, computed on the first call and cached on
+    /// the shape.
+    #[must_use]
+    pub fn aabb(&self) -> BoundingBox {
+        BoundingBox(self.0.aabb().within_box())
+    }
+
+    /// Counts and byte estimates of the kernel entities reachable from this
+    /// shape.
+    #[must_use]
+    pub fn memory_stats(&self) -> MemoryStats {
+        MemoryStats(self.0.memory_stats().within_box())
+    }
+
+    /// Validity check with the per-sub-shape checks run in parallel. Cheap
+    /// enough to run up front instead of discovering bad geometry when a
+    /// fillet or shelling build fails minutes in.
+    #[must_use]
+    pub fn check(&self) -> bool {
+        self.0.check()
+    }
+
+    /// Runs the kernel's healing pass over the shape and returns the
+    /// repaired result; typically paired with [`Shape::check`] after an
+    /// import or boolean.
+    #[must_use]
+    pub fn heal(&self) -> Self {
+        Self(self.0.heal().within_box())
+    }
+
     #[must_use]
     pub fn fuse(&self, other: &Self) -> Self {
         Self(self.0.fuse(&other.0).within_box())
     }
 
+    /// Exception-free variant of [`Shape::fuse`], see
+    /// [`FilletBuilder::try_build`].
+    pub fn try_fuse(&self, other: &Self) -> Result<Self, String> {
+        let mut status = ffi_shape::OperationStatus::new().within_box();
+        let shape = Self(self.0.try_fuse(&other.0, status.as_mut()).within_box());
+        status_to_result(&status).map(|()| shape)
+    }
+
+    /// Fuses all given shapes in one parallel multi-input boolean operation
+    /// instead of a serial chain of pairwise fuses.
+    #[must_use]
+    pub fn fuse_many(shapes: &[&Self]) -> Self {
+        Self(ffi_shape::Shape::fuse_many(&ShapeList::from_shapes(shapes).0).within_box())
+    }
+
+    #[must_use]
+    pub fn cut_many(&self, tools: &[&Self]) -> Self {
+        Self(self.0.cut_many(&ShapeList::from_shapes(tools).0).within_box())
+    }
+
+    #[must_use]
+    pub fn common_many(&self, tools: &[&Self]) -> Self {
+        Self(self.0.common_many(&ShapeList::from_shapes(tools).0).within_box())
+    }
+
+    #[must_use]
+    pub fn triangulate(&self, deflection: f64) -> crate::mesh::Mesh {
+        crate::mesh::Mesh(self.0.triangulate(deflection).within_box())
+    }
+
+    /// Instance placed by composing a location over the shared geometry,
+    /// without copying it.
+    #[must_use]
+    pub fn moved(&self, transformation: &geom::Transformation) -> Self {
+        Self(self.0.moved(&transformation.0).within_box())
+    }
+
+    /// Compound of `count` instances, instance `i` placed at the `i`-th power
+    /// of `step`. Use a translation step for linear patterns and a rotation
+    /// step for circular ones; all instances share one geometry.
+    #[must_use]
+    pub fn pattern(&self, step: &geom::Transformation, count: usize) -> Self {
+        Self(self.0.pattern(&step.0, count).within_box())
+    }
+
     #[must_use]
     pub fn shell(&self) -> ShellBuilder {
         ShellBuilder(ffi_shape::ShellBuilder::create(&self.0).within_box())
@@ -75,6 +219,29 @@ impl Shape {
     pub fn cylinder(axis: &geom::PlaneAxis, radius: f64, height: f64) -> Self {
         Self(ffi_shape::Shape::cylinder(&axis.0.as_ref(), radius, height).within_box())
     }
+
+    /// Axis-aligned box with one corner at `corner` and the opposite one at
+    /// `corner + (dx, dy, dz)`.
+    #[must_use]
+    pub fn cuboid(corner: &geom::Point, dx: f64, dy: f64, dz: f64) -> Self {
+        Self(ffi_shape::Shape::cuboid(&corner.0.as_ref(), dx, dy, dz).within_box())
+    }
+
+    #[must_use]
+    pub fn sphere(center: &geom::Point, radius: f64) -> Self {
+        Self(ffi_shape::Shape::sphere(&center.0.as_ref(), radius).within_box())
+    }
+
+    /// Cone frustum; pass zero for `radius2` to get a full cone.
+    #[must_use]
+    pub fn cone(axis: &geom::PlaneAxis, radius1: f64, radius2: f64, height: f64) -> Self {
+        Self(ffi_shape::Shape::cone(&axis.0.as_ref(), radius1, radius2, height).within_box())
+    }
+
+    #[must_use]
+    pub fn torus(axis: &geom::PlaneAxis, major_radius: f64, minor_radius: f64) -> Self {
+        Self(ffi_shape::Shape::torus(&axis.0.as_ref(), major_radius, minor_radius).within_box())
+    }
 }
 
 impl Clone for Shape {
@@ -83,6 +250,97 @@ impl Clone for Shape {
     }
 }
 
+pub struct ShapeList(pub(crate) Pin<Box<ffi_shape::ShapeList>>);
+
+impl ShapeList {
+    #[must_use]
+    pub fn new() -> Self {
+        Self(ffi_shape::ShapeList::create().within_box())
+    }
+
+    #[must_use]
+    pub fn from_shapes(shapes: &[&Shape]) -> Self {
+        let mut list = Self::new();
+        for shape in shapes {
+            list.add(shape);
+        }
+        list
+    }
+
+    pub fn add(&mut self, shape: &Shape) -> &mut Self {
+        self.0.as_mut().add_shape(&shape.0);
+        self
+    }
+
+    pub fn add_wire(&mut self, wire: &Wire) -> &mut Self {
+        self.0.as_mut().add_wire(&wire.0);
+        self
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+impl Default for ShapeList {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Clone for ShapeList {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Content-addressed interning registry: shapes with identical location-free
+/// geometry are rewritten to share one underlying `TShape`, keeping only
+/// their own location and orientation.
+pub struct ShapeRegistry(pub(crate) Pin<Box<ffi_shape::ShapeRegistry>>);
+
+impl ShapeRegistry {
+    #[must_use]
+    pub fn new() -> Self {
+        Self(ffi_shape::ShapeRegistry::create().within_box())
+    }
+
+    #[must_use]
+    pub fn intern(&mut self, shape: &Shape) -> Shape {
+        Shape(self.0.as_mut().intern(&shape.0).within_box())
+    }
+
+    /// Rebuilds a compound with every direct sub-shape interned; other
+    /// shapes behave like [`ShapeRegistry::intern`].
+    #[must_use]
+    pub fn intern_children(&mut self, shape: &Shape) -> Shape {
+        Shape(self.0.as_mut().intern_children(&shape.0).within_box())
+    }
+
+    #[must_use]
+    pub fn unique_count(&self) -> usize {
+        self.0.unique_count()
+    }
+}
+
+impl Default for ShapeRegistry {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Clone for ShapeRegistry {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
 pub struct EdgeIterator(pub(crate) Pin<Box<ffi_shape::EdgeIterator>>);
 
 impl Iterator for EdgeIterator {
@@ -125,16 +383,381 @@ impl Clone for FaceIterator {
     }
 }
 
+pub struct EdgeMap(pub(crate) Pin<Box<ffi_shape::EdgeMap>>);
+
+impl EdgeMap {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    #[must_use]
+    pub fn get(&self, index: usize) -> Option<Edge> {
+        (index < self.len()).then(|| Edge(self.0.at(index).within_box()))
+    }
+
+    /// Fetches every edge of the map at once.
+    #[must_use]
+    pub fn all(&self) -> Vec<Edge> {
+        (0..self.len())
+            .map(|index| Edge(self.0.at(index).within_box()))
+            .collect()
+    }
+}
+
+impl Clone for EdgeMap {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+pub struct FaceMap(pub(crate) Pin<Box<ffi_shape::FaceMap>>);
+
+impl FaceMap {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    #[must_use]
+    pub fn get(&self, index: usize) -> Option<Face> {
+        (index < self.len()).then(|| Face(self.0.at(index).within_box()))
+    }
+
+    /// Fetches every face of the map at once.
+    #[must_use]
+    pub fn all(&self) -> Vec<Face> {
+        (0..self.len())
+            .map(|index| Face(self.0.at(index).within_box()))
+            .collect()
+    }
+}
+
+impl Clone for FaceMap {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum SurfaceType {
+    Other,
+    Plane,
+    Cylinder,
+    Sphere,
+    Cone,
+    Torus,
+}
+
+impl From<u32> for SurfaceType {
+    fn from(value: u32) -> Self {
+        match value {
+            1 => Self::Plane,
+            2 => Self::Cylinder,
+            3 => Self::Sphere,
+            4 => Self::Cone,
+            5 => Self::Torus,
+            _ => Self::Other,
+        }
+    }
+}
+
+/// Surface classification of every face of a shape, indexed like
+/// [`FaceMap`].
+pub struct FaceClassification(pub(crate) Pin<Box<ffi_shape::FaceClassification>>);
+
+impl FaceClassification {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    #[must_use]
+    pub fn surface_type(&self, index: usize) -> Option<SurfaceType> {
+        // SAFETY: pointer and length describe the same C++ vector, which
+        // lives as long as `self` and is never mutated through this wrapper.
+        let types = unsafe { crate::mesh::slice_or_empty(self.0.type_data(), self.0.size()) };
+        types.get(index).map(|&value| SurfaceType::from(value))
+    }
+
+    /// Origin of the face's plane, or `None` for non-planar faces.
+    #[must_use]
+    pub fn plane_origin(&self, index: usize) -> Option<[f64; 3]> {
+        self.planar_triplet(index, self.0.origin_data())
+    }
+
+    /// Normal of the face's plane, or `None` for non-planar faces.
+    #[must_use]
+    pub fn plane_normal(&self, index: usize) -> Option<[f64; 3]> {
+        self.planar_triplet(index, self.0.normal_data())
+    }
+
+    fn planar_triplet(&self, index: usize, data: *const f64) -> Option<[f64; 3]> {
+        if self.surface_type(index)? != SurfaceType::Plane {
+            return None;
+        }
+        // SAFETY: see `surface_type`; the buffer holds three values per face.
+        let values = unsafe { crate::mesh::slice_or_empty(data, self.0.size() * 3) };
+        Some([values[index * 3], values[index * 3 + 1], values[index * 3 + 2]])
+    }
+}
+
+impl Clone for FaceClassification {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Arena for the transient containers churned through during one feature
+/// evaluation. Lists and maps created through the context draw their nodes
+/// from one incremental allocator instead of individual heap allocations;
+/// [`ConstructionContext::reset`] releases them all in bulk at rebuild end
+/// and keeps the blocks for the next rebuild.
+pub struct ConstructionContext(pub(crate) Pin<Box<ffi_shape::ConstructionContext>>);
+
+impl ConstructionContext {
+    #[must_use]
+    pub fn new() -> Self {
+        Self(ffi_shape::ConstructionContext::create().within_box())
+    }
+
+    /// A [`ShapeList`] whose nodes live in this arena.
+    #[must_use]
+    pub fn shape_list(&self) -> ShapeList {
+        ShapeList(self.0.make_shape_list().within_box())
+    }
+
+    /// Arena-backed variant of [`Shape::edge_map`].
+    #[must_use]
+    pub fn edge_map(&self, shape: &Shape) -> EdgeMap {
+        EdgeMap(self.0.make_edge_map(&shape.0).within_box())
+    }
+
+    /// Arena-backed variant of [`Shape::face_map`].
+    #[must_use]
+    pub fn face_map(&self, shape: &Shape) -> FaceMap {
+        FaceMap(self.0.make_face_map(&shape.0).within_box())
+    }
+
+    /// Releases everything allocated from this context in one step, keeping
+    /// the arena blocks for the next rebuild.
+    ///
+    /// # Safety
+    ///
+    /// Every [`ShapeList`], [`EdgeMap`] and [`FaceMap`] created through this
+    /// context (or through one of its clones, which share the arena) must
+    /// have been dropped; their nodes live in the released blocks and using
+    /// such a container afterwards reads freed memory. Dropping the context
+    /// releases the arena safely without this restriction.
+    pub unsafe fn reset(&mut self) {
+        self.0.as_mut().reset();
+    }
+}
+
+impl Default for ConstructionContext {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// The clone shares the arena, like the handle semantics of the kernel.
+impl Clone for ConstructionContext {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum MemoryCategory {
+    TShapes,
+    Curves,
+    Surfaces,
+    Triangulations,
+}
+
+/// Memory footprint of a shape, per kernel category. Entities shared
+/// between sub-shapes are counted once, so the stats of a compound
+/// aggregate its children without double counting. The byte figures are
+/// estimates meant for comparing categories and revisions, not exact
+/// accounting.
+pub struct MemoryStats(pub(crate) Pin<Box<ffi_shape::MemoryStats>>);
+
+impl MemoryStats {
+    #[must_use]
+    pub fn count(&self, category: MemoryCategory) -> u64 {
+        self.0.count(category as u32)
+    }
+
+    #[must_use]
+    pub fn byte_estimate(&self, category: MemoryCategory) -> u64 {
+        self.0.byte_estimate(category as u32)
+    }
+
+    #[must_use]
+    pub fn total_bytes(&self) -> u64 {
+        self.0.total_bytes()
+    }
+}
+
+impl Clone for MemoryStats {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Axis-aligned bounding box of a shape, cheap enough for view fitting and
+/// broad-phase culling without tessellating.
+pub struct BoundingBox(pub(crate) Pin<Box<ffi_shape::BoundingBox>>);
+
+impl BoundingBox {
+    #[must_use]
+    pub fn is_void(&self) -> bool {
+        self.0.is_void()
+    }
+
+    #[must_use]
+    pub fn min(&self) -> geom::Point {
+        geom::Point(self.0.min().within_box())
+    }
+
+    #[must_use]
+    pub fn max(&self) -> geom::Point {
+        geom::Point(self.0.max().within_box())
+    }
+
+    /// Broad-phase overlap test: `false` only if the boxes are guaranteed
+    /// disjoint.
+    #[must_use]
+    pub fn intersects(&self, other: &Self) -> bool {
+        self.0.intersects(&other.0)
+    }
+}
+
+impl Clone for BoundingBox {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Result of a [`SpatialIndex`] query. For [`SpatialIndex::pick`] the
+/// distance is the ray parameter of the nearest intersection; for
+/// [`SpatialIndex::closest_point`] it is the euclidean distance to the
+/// shape.
+pub struct PickResult(pub(crate) Pin<Box<ffi_shape::PickResult>>);
+
+impl PickResult {
+    #[must_use]
+    pub fn is_hit(&self) -> bool {
+        self.0.is_hit()
+    }
+
+    #[must_use]
+    pub fn point(&self) -> geom::Point {
+        geom::Point(self.0.point().within_box())
+    }
+
+    #[must_use]
+    pub fn distance(&self) -> f64 {
+        self.0.distance()
+    }
+}
+
+impl Clone for PickResult {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Spatial index over the faces of a shape, built once via
+/// [`Shape::build_bvh`] and reused across queries.
+pub struct SpatialIndex(pub(crate) Pin<Box<ffi_shape::SpatialIndex>>);
+
+impl SpatialIndex {
+    #[must_use]
+    pub fn new(shape: &Shape) -> Self {
+        Self(ffi_shape::SpatialIndex::new(&shape.0).within_box())
+    }
+
+    /// Nearest intersection of the ray with the shape, in front of the
+    /// ray origin only.
+    #[must_use]
+    pub fn pick(&mut self, ray: &geom::Axis) -> PickResult {
+        PickResult(self.0.as_mut().pick(&ray.0).within_box())
+    }
+
+    #[must_use]
+    pub fn closest_point(&self, point: &geom::Point) -> PickResult {
+        PickResult(self.0.closest_point(&point.0).within_box())
+    }
+}
+
+/// Converts the status filled in by a C++ `try_` variant into a `Result`.
+pub(crate) fn status_to_result(status: &ffi_shape::OperationStatus) -> Result<(), String> {
+    if status.is_failure() {
+        Err(status.error_message().to_string())
+    } else {
+        Ok(())
+    }
+}
+
 pub struct FilletBuilder(pub(crate) Pin<Box<ffi_shape::FilletBuilder>>);
 
 impl FilletBuilder {
     pub fn add(&mut self, radius: f64, edge: &Edge) {
         self.0.as_mut().add_edge(radius, &edge.0);
     }
+    /// Adds every edge of the shape with one call.
+    pub fn add_all_edges(&mut self, radius: f64, shape: &Shape) -> &mut Self {
+        self.0.as_mut().add_all_edges(radius, &shape.0);
+        self
+    }
+    /// Adds the edges of `edges` selected by index with one call. Indices
+    /// outside the map are ignored.
+    pub fn add_edges(&mut self, radius: f64, edges: &EdgeMap, indices: &[u32]) -> &mut Self {
+        self.0
+            .as_mut()
+            .add_edge_indices(radius, &edges.0, indices.as_ptr(), indices.len());
+        self
+    }
+    /// Reports into (and honors cancellation of) the given tracker during
+    /// `build`. A cancelled build returns a null shape (see
+    /// [`Shape::is_null`]).
+    pub fn track_progress(&mut self, tracker: &crate::task::ProgressTracker) -> &mut Self {
+        self.0.as_mut().track_progress(&tracker.0);
+        self
+    }
     #[must_use]
     pub fn build(&mut self) -> Shape {
         Shape(self.0.as_mut().build().within_box())
     }
+    /// Exception-free variant of [`FilletBuilder::build`]: kernel failures
+    /// are caught inside C++ and returned as an error message instead of
+    /// unwinding across the FFI boundary.
+    pub fn try_build(&mut self) -> Result<Shape, String> {
+        let mut status = ffi_shape::OperationStatus::new().within_box();
+        let shape = Shape(self.0.as_mut().try_build(status.as_mut()).within_box());
+        status_to_result(&status).map(|()| shape)
+    }
+    /// Runs the build on the C++ worker pool instead of the calling thread.
+    #[must_use]
+    pub fn build_async(&self) -> crate::task::PendingShape {
+        crate::task::PendingShape(self.0.build_async().within_box())
+    }
 }
 
 impl Clone for FilletBuilder {
@@ -163,9 +786,30 @@ impl ShellBuilder {
         self
     }
 
+    /// Reports into (and honors cancellation of) the given tracker during
+    /// `build`. A cancelled build returns a null shape (see
+    /// [`Shape::is_null`]).
+    pub fn track_progress(&mut self, tracker: &crate::task::ProgressTracker) -> &mut Self {
+        self.0.as_mut().track_progress(&tracker.0);
+        self
+    }
+
     pub fn build(&mut self) -> Shape {
         Shape(self.0.as_mut().build().within_box())
     }
+
+    /// See [`FilletBuilder::try_build`].
+    pub fn try_build(&mut self) -> Result<Shape, String> {
+        let mut status = ffi_shape::OperationStatus::new().within_box();
+        let shape = Shape(self.0.as_mut().try_build(status.as_mut()).within_box());
+        status_to_result(&status).map(|()| shape)
+    }
+
+    /// Runs the build on the C++ worker pool instead of the calling thread.
+    #[must_use]
+    pub fn build_async(&self) -> crate::task::PendingShape {
+        crate::task::PendingShape(self.0.build_async().within_box())
+    }
 }
 
 impl Clone for ShellBuilder {
@@ -213,6 +857,18 @@ impl Face {
         Shape(self.0.extrude(&vec.0).within_box())
     }
 
+    /// Solid of revolution of this face around `axis`, `angle` in radians.
+    #[must_use]
+    pub fn revolve(&self, axis: &geom::Axis, angle: f64) -> Shape {
+        Shape(self.0.revolve(&axis.0, angle).within_box())
+    }
+
+    /// Sweep this face along the spine wire.
+    #[must_use]
+    pub fn sweep(&self, spine: &Wire) -> Shape {
+        Shape(self.0.sweep(&spine.0).within_box())
+    }
+
     #[must_use]
     pub fn surface(&self) -> geom::Surface {
         geom::Surface(self.0.surface().within_box())
@@ -239,6 +895,47 @@ impl Wire {
         Self(ffi_shape::Wire::create(w.as_mut()).within_box())
     }
 
+    /// Exception-free variant of [`Wire::new`] for plain edges: a rejected
+    /// or non-connectable edge is reported as an error instead of unwinding
+    /// across the FFI boundary.
+    pub fn try_new(edges: &[&Edge]) -> Result<Self, String> {
+        // Asking the builder for a wire without any edges would raise
+        // StdFail_NotDone across the FFI boundary.
+        if edges.is_empty() {
+            return Err("cannot build a wire from zero edges".to_string());
+        }
+        moveit! {
+            let mut w = ffi_shape::WireBuilder::new();
+        }
+        for edge in edges {
+            let status = w.as_mut().try_add_edge(&edge.0).within_box();
+            status_to_result(&status)?;
+        }
+        Ok(Self(ffi_shape::Wire::create(w.as_mut()).within_box()))
+    }
+
+    /// One-shot polyline constructor: one segment edge per consecutive point
+    /// pair, plus a closing segment when `closed`. Fewer than two points
+    /// yield a null wire, detectable with [`Wire::is_null`].
+    #[must_use]
+    pub fn from_points(coordinates: &[[f64; 3]], closed: bool) -> Self {
+        Self(
+            ffi_shape::Wire::from_points(
+                coordinates.as_ptr().cast::<f64>(),
+                coordinates.len(),
+                closed,
+            )
+            .within_box(),
+        )
+    }
+
+    /// Whether this wire holds no topology, as returned by
+    /// [`Wire::from_points`] for degenerate input.
+    #[must_use]
+    pub fn is_null(&self) -> bool {
+        self.0.is_null()
+    }
+
     #[must_use]
     pub fn face(&self) -> Face {
         Face(self.0.face().within_box())
@@ -289,10 +986,19 @@ impl Loft {
         Self(loft)
     }
 
-    pub fn add_wires(&mut self, wire: &[&Wire]) -> &mut Self {
-        for w in wire {
-            self.0.as_mut().add_wire(&w.0);
+    pub fn add_wire(&mut self, wire: &Wire) -> &mut Self {
+        self.0.as_mut().add_wire(&wire.0);
+        self
+    }
+
+    /// Bulk variant of [`Loft::add_wire`]: appends all sections with a
+    /// single FFI crossing.
+    pub fn add_wires(&mut self, wires: &[&Wire]) -> &mut Self {
+        let mut sections = ShapeList::new();
+        for wire in wires {
+            sections.add_wire(wire);
         }
+        self.0.as_mut().add_wires(&sections.0);
         self
     }
 
@@ -304,6 +1010,19 @@ impl Loft {
     pub fn build(&mut self) -> Shape {
         Shape(self.0.as_mut().build().within_box())
     }
+
+    /// See [`FilletBuilder::try_build`].
+    pub fn try_build(&mut self) -> Result<Shape, String> {
+        let mut status = ffi_shape::OperationStatus::new().within_box();
+        let shape = Shape(self.0.as_mut().try_build(status.as_mut()).within_box());
+        status_to_result(&status).map(|()| shape)
+    }
+
+    /// Runs the build on the C++ worker pool instead of the calling thread.
+    #[must_use]
+    pub fn build_async(&self) -> crate::task::PendingShape {
+        crate::task::PendingShape(self.0.build_async().within_box())
+    }
 }
 
 impl Clone for Loft {
@@ -0,0 +1,68 @@
+use crate::ffi::occara::task as ffi_task;
+use crate::shape::Shape;
+use autocxx::prelude::*;
+use std::pin::Pin;
+
+/// Handle to a modeling operation running on the C++ worker pool.
+pub struct PendingShape(pub(crate) Pin<Box<ffi_task::PendingShape>>);
+
+impl PendingShape {
+    #[must_use]
+    pub fn is_ready(&self) -> bool {
+        self.0.is_ready()
+    }
+
+    /// Blocks until the operation has finished and returns its result. An
+    /// operation that failed with a kernel exception yields a null shape,
+    /// see [`Shape::is_null`].
+    #[must_use]
+    pub fn wait(&self) -> Shape {
+        Shape(self.0.wait().within_box())
+    }
+}
+
+impl Clone for PendingShape {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Progress and cancellation token for long-running builders. Hand a clone to
+/// a builder via its `track_progress` method, then poll or cancel from any
+/// thread while the build runs.
+pub struct ProgressTracker(pub(crate) Pin<Box<ffi_task::ProgressTracker>>);
+
+impl ProgressTracker {
+    #[must_use]
+    pub fn new() -> Self {
+        Self(ffi_task::ProgressTracker::create().within_box())
+    }
+
+    /// Completed fraction of the running operation, in `0.0..=1.0`.
+    #[must_use]
+    pub fn progress(&self) -> f64 {
+        self.0.progress()
+    }
+
+    /// Aborts the tracked operation at its next progress checkpoint.
+    pub fn cancel(&mut self) {
+        self.0.as_mut().cancel();
+    }
+
+    #[must_use]
+    pub fn is_cancelled(&self) -> bool {
+        self.0.is_cancelled()
+    }
+}
+
+impl Default for ProgressTracker {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Clone for ProgressTracker {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
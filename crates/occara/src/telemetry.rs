@@ -0,0 +1,78 @@
+use crate::ffi::occara::telemetry as ffi_telemetry;
+use autocxx::prelude::*;
+use std::pin::Pin;
+
+/// Enables or disables the global timing telemetry. It is off by default;
+/// while disabled, instrumented kernel entry points cost a single atomic
+/// load.
+pub fn set_enabled(enabled: bool) {
+    ffi_telemetry::set_enabled(enabled);
+}
+
+#[must_use]
+pub fn is_enabled() -> bool {
+    ffi_telemetry::is_enabled()
+}
+
+/// Moves all records collected so far out of the global buffer. Poll this
+/// periodically (or after a rebuild) to see where the kernel spent its
+/// time.
+#[must_use]
+pub fn drain() -> RecordList {
+    RecordList(ffi_telemetry::drain().within_box())
+}
+
+/// One timed kernel operation. The input size is operation specific: the
+/// number of tool shapes for booleans, contours for fillets, removed faces
+/// for shelling, sections for lofts and evaluated stages for the bottle
+/// pipeline.
+pub struct Record(pub(crate) Pin<Box<ffi_telemetry::Record>>);
+
+impl Record {
+    #[must_use]
+    pub fn operation(&self) -> String {
+        self.0.operation_name().to_string()
+    }
+
+    #[must_use]
+    pub fn milliseconds(&self) -> f64 {
+        self.0.milliseconds()
+    }
+
+    #[must_use]
+    pub fn input_size(&self) -> u64 {
+        self.0.input_size()
+    }
+}
+
+impl Clone for Record {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
+
+/// Records drained from the global telemetry buffer.
+pub struct RecordList(pub(crate) Pin<Box<ffi_telemetry::RecordList>>);
+
+impl RecordList {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.size()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    #[must_use]
+    pub fn get(&self, index: usize) -> Option<Record> {
+        (index < self.len()).then(|| Record(self.0.at(index).within_box()))
+    }
+}
+
+impl Clone for RecordList {
+    fn clone(&self) -> Self {
+        Self(self.0.clone().within_box())
+    }
+}
@@ -0,0 +1,100 @@
+//! Behavior tests for the cheap, deterministic invariants of the kernel
+//! layer: stage skipping in the staged pipeline, serialization round trips,
+//! the indexed archive and the stable edge counts of simple shapes.
+
+use occara::geom::{Point, Transformation, Vector};
+use occara::io::ShapeArchive;
+use occara::shape::{Shape, Wire};
+
+fn unit_cube() -> Shape {
+    Shape::cuboid(&Point::new(0.0, 0.0, 0.0), 1.0, 1.0, 1.0)
+}
+
+#[test]
+fn bottle_pipeline_skips_unchanged_stages() {
+    use occara::internal::BottlePipeline;
+
+    let mut pipeline = BottlePipeline::new();
+    let _bottle = pipeline.build(50.0, 70.0, 30.0);
+    assert_eq!(pipeline.evaluated_stage_count(), 6);
+
+    // Identical parameters: every stage is served from its cache.
+    let _bottle = pipeline.build(50.0, 70.0, 30.0);
+    assert_eq!(pipeline.evaluated_stage_count(), 0);
+
+    // A width edit re-evaluates its dependents but not the whole pipeline.
+    let _bottle = pipeline.build(51.0, 70.0, 30.0);
+    let evaluated = pipeline.evaluated_stage_count();
+    assert!(evaluated > 0 && evaluated < 6);
+}
+
+#[test]
+fn binary_serialization_round_trip() {
+    let cube = unit_cube();
+    let data = cube.serialize();
+    assert!(!data.is_empty());
+
+    let restored = Shape::deserialize(data.bytes()).expect("round trip succeeds");
+    assert!(!restored.is_null());
+    assert_eq!(restored.edge_map().len(), cube.edge_map().len());
+
+    // Bad bytes are a normal error path, not a kernel exception.
+    assert!(Shape::deserialize(&data.bytes()[..data.len() / 2]).is_err());
+    assert!(Shape::deserialize(b"not a brep").is_err());
+}
+
+#[test]
+fn shape_archive_save_open_load() {
+    let step = Transformation::translation(&Vector::new(2.0, 0.0, 0.0));
+    let compound = unit_cube().pattern(&step, 3);
+
+    let path = std::env::temp_dir().join(format!("occara_kernel_{}.occar", std::process::id()));
+    let path = path.to_str().expect("temp path is valid UTF-8");
+    ShapeArchive::save(&compound, path);
+
+    let mut archive = ShapeArchive::open(path);
+    assert_eq!(archive.len(), 3);
+    assert!(!archive.is_loaded(0));
+
+    let body = archive.load(0).expect("record 0 exists");
+    assert!(!body.is_null());
+    assert!(archive.is_loaded(0));
+    assert!(!archive.is_loaded(1));
+
+    // Out-of-range access reports instead of crashing.
+    assert!(archive.load(3).is_none());
+    assert!(!archive.is_loaded(3));
+
+    let _ = std::fs::remove_file(path);
+}
+
+#[test]
+fn edge_map_counts_primitive_edges() {
+    assert_eq!(unit_cube().edge_map().len(), 12);
+
+    // The map visits shared edges once, so a two-instance compound simply
+    // doubles the count.
+    let step = Transformation::translation(&Vector::new(2.0, 0.0, 0.0));
+    assert_eq!(unit_cube().pattern(&step, 2).edge_map().len(), 24);
+}
+
+#[test]
+fn wire_from_points_builds_expected_edges() {
+    let square = [
+        [0.0, 0.0, 0.0],
+        [1.0, 0.0, 0.0],
+        [1.0, 1.0, 0.0],
+        [0.0, 1.0, 0.0],
+    ];
+    let wire = Wire::from_points(&square, true);
+    assert!(!wire.is_null());
+
+    // Four boundary edges, each extruded into a lateral face: the prism over
+    // the closed square has the same twelve edges as a box.
+    let prism = wire.face().extrude(&Vector::new(0.0, 0.0, 1.0));
+    assert_eq!(prism.edge_map().len(), 12);
+
+    // Degenerate polylines yield a null wire instead of a kernel exception.
+    assert!(Wire::from_points(&[], false).is_null());
+    assert!(Wire::from_points(&square[..1], true).is_null());
+}
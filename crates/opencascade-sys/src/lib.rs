@@ -169,6 +169,10 @@ impl OpenCascadeBuild {
         println!("cargo:rustc-link-search=native={}", self.lib_dir.display());
         // I dont't know why this order works, but it does, so I'm not going to mess with it for now
         let lib_linking_order = vec![
+            // The data exchange toolkits reference many of the modeling
+            // toolkits below, so they have to come first.
+            "TKDESTEP",
+            "TKXSBase",
             "TKBO",
             "TKBool",
             "TKBRep",